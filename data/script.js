@@ -199,7 +199,13 @@ async function pollStatus() {
 
 // -- Network scan -----------------------------------------------------------
 
-async function scanNetworks() {
+// The device scans in the background and /api/scan answers straight away
+// with whatever it has. While a scan is running we keep asking until it
+// has finished, showing the older list in the meantime.
+const SCAN_POLL_MS = 1500;
+const SCAN_POLL_MAX = 10;
+
+async function scanNetworks(refresh = false) {
     networksList.innerHTML = `
         <div class="loading">
             <div class="spinner"></div>
@@ -210,9 +216,17 @@ async function scanNetworks() {
     rescanBtn.textContent = 'Scanning...';
 
     try {
-        const response = await fetch('/api/scan');
-        const networks = await response.json();
-        renderNetworks(networks);
+        let url = refresh ? '/api/scan?refresh=1' : '/api/scan';
+        for (let i = 0; i < SCAN_POLL_MAX; i++) {
+            const response = await fetch(url);
+            const result = await response.json();
+            if (result.networks.length > 0 || !result.scanning) {
+                renderNetworks(result.networks);
+            }
+            if (!result.scanning) break;
+            url = '/api/scan';
+            await new Promise(resolve => setTimeout(resolve, SCAN_POLL_MS));
+        }
     } catch {
         networksList.innerHTML = `
             <div class="empty">
@@ -281,7 +295,7 @@ async function handleConnect(e) {
 }
 
 // Event listeners
-rescanBtn.addEventListener('click', scanNetworks);
+rescanBtn.addEventListener('click', () => scanNetworks(true));
 cancelBtn.addEventListener('click', closeModal);
 connectForm.addEventListener('submit', handleConnect);
 modal.addEventListener('click', (e) => {
@@ -0,0 +1,64 @@
+#include "axs5106l_sim.h"
+
+AXS5106LSim::AXS5106LSim(TwoWire& wire, int8_t int_pin) : int_pin_(int_pin) {
+    wire.attach(AXS5106L_I2C_ADDR, this);
+    if (int_pin_ >= 0) digitalWrite(int_pin_, HIGH);
+}
+
+void AXS5106LSim::press(uint16_t x, uint16_t y) {
+    TouchPoint p = { x, y };
+    press(&p, 1);
+}
+
+void AXS5106LSim::press(const TouchPoint* points, uint8_t count) {
+    if (count > AXS5106L_MAX_POINTS) count = AXS5106L_MAX_POINTS;
+    std::unique_lock<std::mutex> lk(lock_);
+    regs_[REG_TOUCH] = 0;
+    regs_[REG_TOUCH + 1] = count;
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t* p = &regs_[REG_TOUCH + 2 + i * 6];
+        p[0] = 0x80 | ((points[i].x >> 8) & 0x0F);   // event: contact
+        p[1] = points[i].x & 0xFF;
+        p[2] = (i << 4) | ((points[i].y >> 8) & 0x0F);
+        p[3] = points[i].y & 0xFF;
+        p[4] = 0;
+        p[5] = 0;
+    }
+    lk.unlock();
+    report(count > 0);
+}
+
+void AXS5106LSim::release() {
+    {
+        std::lock_guard<std::mutex> lk(lock_);
+        regs_[REG_TOUCH + 1] = 0;
+    }
+    report(false);
+}
+
+void AXS5106LSim::report(bool down) {
+    if (int_pin_ < 0) return;
+    // One INT edge per report, the lift included; the line stays low while
+    // a finger is down
+    digitalWrite(int_pin_, LOW);
+    hostRaiseInterrupt(int_pin_);
+    if (!down) digitalWrite(int_pin_, HIGH);
+}
+
+void AXS5106LSim::onWrite(const uint8_t* data, size_t len) {
+    std::lock_guard<std::mutex> lk(lock_);
+    if (len > 0) pointer_ = data[0];
+}
+
+size_t AXS5106LSim::onRead(uint8_t* data, size_t len) {
+    std::lock_guard<std::mutex> lk(lock_);
+    reads_++;
+    // 0x08 overlaps the first point; a read starting there returns the ID
+    static const uint8_t ID[] = { 0x51, 0x06, 0x01 };
+    if (pointer_ == REG_ID) {
+        for (size_t i = 0; i < len; i++) data[i] = i < sizeof(ID) ? ID[i] : 0;
+        return len;
+    }
+    for (size_t i = 0; i < len; i++) data[i] = regs_[(uint8_t)(pointer_ + i)];
+    return len;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+// AXS5106L touch controller on the host I2C bus (see Wire.h).
+//
+// Models the register file the driver reads: a write sets the register
+// pointer, reads return consecutive registers from it. 0x01 holds the
+// gesture byte, 0x02 the point count, then six bytes per point (X and Y
+// with the event flags in the high nibble). A read starting at 0x08 returns
+// the chip ID. Each press() or release() is one report: an INT edge
+// (running the attached handler), with the line then held low while a
+// finger is down.
+
+#include <Wire.h>
+#include <atomic>
+#include <mutex>
+#include "axs5106l.h"
+
+class AXS5106LSim : public HostI2CDevice {
+public:
+    static constexpr uint8_t REG_TOUCH = 0x01;
+    static constexpr uint8_t REG_ID    = 0x08;
+
+    // Attach to 'wire' at the controller's address; int_pin < 0 for no INT
+    AXS5106LSim(TwoWire& wire, int8_t int_pin = -1);
+
+    // Panel-native (portrait) coordinates
+    void press(uint16_t x, uint16_t y);
+    void press(const TouchPoint* points, uint8_t count);
+    void release();
+
+    uint32_t reads() const { return reads_; }   // I2C reads served
+
+    void onWrite(const uint8_t* data, size_t len) override;
+    size_t onRead(uint8_t* data, size_t len) override;
+
+private:
+    void report(bool down);
+
+    std::mutex lock_;   // the driver reads from its own task
+    uint8_t regs_[256] = {};
+    uint8_t pointer_ = 0;
+    int8_t int_pin_;
+    std::atomic<uint32_t> reads_{0};
+};
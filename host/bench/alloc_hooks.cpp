@@ -0,0 +1,69 @@
+// Counts every heap allocation in the bench binary.
+//
+// operator new is replaced to go through malloc, and malloc/calloc/realloc
+// are wrapped at link time (-Wl,--wrap=..., see env:native), so String,
+// std containers and the firmware's own malloc calls all land here.
+
+#include "bench.h"
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+
+static std::atomic<uint64_t> alloc_count{0};
+static std::atomic<uint64_t> alloc_bytes{0};
+
+AllocStats allocTotals() {
+    return { alloc_count.load(std::memory_order_relaxed),
+             alloc_bytes.load(std::memory_order_relaxed) };
+}
+
+static void record(size_t size) {
+    alloc_count.fetch_add(1, std::memory_order_relaxed);
+    alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+extern "C" {
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    record(size);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t n, size_t size) {
+    record(n * size);
+    return __real_calloc(n, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    record(size);
+    return __real_realloc(ptr, size);
+}
+
+} // extern "C"
+
+void* operator new(size_t size) {
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return malloc(size ? size : 1);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return malloc(size ? size : 1);
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
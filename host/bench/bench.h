@@ -0,0 +1,76 @@
+#pragma once
+
+// Microbenchmarks for host builds (env:native).
+//
+//   BENCH(json_extract) {
+//       String body = ...;                  // setup runs once per batch
+//       while (state.keepRunning()) {
+//           doNotOptimize(extractJsonValue(body, "ssid"));
+//       }
+//   }
+//
+// The runner grows the batch until it takes at least --min-ms, then reports
+// ns/op plus heap allocations and bytes per op (every operator new and
+// malloc in the process is counted, see alloc_hooks.cpp). Benchmarks can
+// add their own per-op counters with state.counter().
+
+#include <stdint.h>
+#include <stddef.h>
+
+struct AllocStats {
+    uint64_t count;
+    uint64_t bytes;
+};
+
+// Totals since process start, from alloc_hooks.cpp
+AllocStats allocTotals();
+
+class BenchState {
+public:
+    explicit BenchState(uint64_t iterations) : target_(iterations) {}
+
+    // True until the batch is done; starts the clock on the first call
+    bool keepRunning();
+
+    // Exclude setup inside the loop from timing and allocation counts
+    void pause();
+    void resume();
+
+    // Adds a named total, reported divided by the iteration count
+    void counter(const char* name, double total);
+
+    uint64_t iterations() const { return target_; }
+
+private:
+    friend class BenchRunner;
+    static constexpr int MAX_COUNTERS = 2;
+
+    uint64_t target_;
+    uint64_t done_ = 0;
+    bool started_ = false;
+    bool paused_ = false;
+    uint64_t startNs_ = 0;
+    uint64_t elapsedNs_ = 0;
+    AllocStats startAlloc_ = {};
+    AllocStats alloc_ = {};
+
+    const char* counterName_[MAX_COUNTERS] = {};
+    double counterTotal_[MAX_COUNTERS] = {};
+};
+
+typedef void (*BenchFn)(BenchState& state);
+
+struct BenchRegistrar {
+    BenchRegistrar(const char* name, BenchFn fn);
+};
+
+#define BENCH(name)                                                   \
+    static void bench_##name(BenchState& state);                      \
+    static BenchRegistrar bench_reg_##name(#name, bench_##name);      \
+    static void bench_##name(BenchState& state)
+
+// Keeps 'value' from being optimized away
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
@@ -0,0 +1,79 @@
+#include "bench.h"
+#include "soft_panel.h"
+#include "display_context.h"
+#include "font_metrics.h"
+#include "colors.h"
+#include "assets/logo_bitmap.h"
+
+struct Rig {
+    SoftPanel panel;
+    DisplayContext dc;
+
+    explicit Rig(bool buffered) : panel(172, 320), dc(&panel) {
+        panel.begin();
+        panel.setRotation(1);
+        dc.enableDoubleBuffer(buffered);
+        dc.setColor(COLOR_WHITE, COLOR_BLACK);
+    }
+};
+
+static void reportPanel(BenchState& state, Rig& rig) {
+    rig.dc.waitForFlush();
+    state.counter("bus_bytes", rig.panel.stats().busBytes);
+}
+
+BENCH(display_text_repeat_buffered) {
+    Rig rig(true);
+    rig.panel.resetStats();
+    while (state.keepRunning()) {
+        rig.dc.drawText(160, 86, DisplayContext::FONT_MEDIUM, "Waiting for dashboard...",
+                        DisplayContext::TEXT_JUSTIFY_CENTER | DisplayContext::TEXT_JUSTIFY_VCENTER);
+    }
+}
+
+BENCH(display_text_changing_direct) {
+    Rig rig(false);
+    char buf[16];
+    uint32_t n = 0;
+    rig.panel.resetStats();
+    while (state.keepRunning()) {
+        snprintf(buf, sizeof(buf), "%lu", (unsigned long)n++);
+        rig.dc.drawText(160, 86, DisplayContext::FONT_MONO, buf,
+                        DisplayContext::TEXT_JUSTIFY_CENTER | DisplayContext::TEXT_JUSTIFY_VCENTER);
+    }
+    reportPanel(state, rig);
+}
+
+BENCH(display_static_text_buffered) {
+    static constexpr DisplayContext::StaticText LABEL =
+        staticText<DisplayContext::FONT_SMALL>("scorescrape.io/dashboard");
+    Rig rig(true);
+    while (state.keepRunning()) {
+        rig.dc.drawText(160, 24, LABEL, DisplayContext::TEXT_JUSTIFY_CENTER | DisplayContext::TEXT_JUSTIFY_VCENTER);
+    }
+}
+
+BENCH(display_rle_logo_buffered) {
+    Rig rig(true);
+    while (state.keepRunning()) {
+        rig.dc.drawBitmap(24, 54, logo_bitmap);
+    }
+}
+
+BENCH(display_strip_update_swap) {
+    // The onboarding status strip: clear + text inside a clip, then flush
+    Rig rig(true);
+    rig.dc.clear();
+    rig.dc.swapBuffers();
+    rig.dc.waitForFlush();
+    rig.panel.resetStats();
+    while (state.keepRunning()) {
+        rig.dc.setClip(0, 148, 320, 24);
+        rig.dc.clear();
+        rig.dc.drawText(160, 160, DisplayContext::FONT_SMALL, "Waiting for dashboard...",
+                        DisplayContext::TEXT_JUSTIFY_CENTER | DisplayContext::TEXT_JUSTIFY_VCENTER);
+        rig.dc.clearClip();
+        rig.dc.swapBuffers();
+    }
+    reportPanel(state, rig);
+}
@@ -0,0 +1,148 @@
+#include "bench.h"
+#include "json_util.h"
+#include <algorithm>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+// Body posted by the portal's connect form (data/script.js)
+static const char* CONNECT_BODY =
+    "{\"ssid\":\"ScoreScrape-Guest\",\"pass\":\"correct horse battery\","
+    "\"user\":\"\",\"enterprise\":false}";
+
+static const char* PROVISION_MSG =
+    "{\"type\":\"provision\",\"bridge_id\":\"br_8f3a2c1d9e7b4a60\",\"name\":\"Main Gym\"}";
+
+// Payloads the firmware sees or might, one per file, under valid/ or
+// invalid/ by what parse() has to make of them
+static const char* CORPUS_DIR = "host/json_corpus";
+
+BENCH(json_connect_body_4_fields) {
+    size_t len = strlen(CONNECT_BODY);
+    char ssid[33], pass[65], user[65];
+    while (state.keepRunning()) {
+        JsonDoc doc;
+        doNotOptimize(doc.parse(CONNECT_BODY, len));
+        doNotOptimize(doc.get("ssid").copyTo(ssid, sizeof(ssid)));
+        doNotOptimize(doc.get("pass").copyTo(pass, sizeof(pass)));
+        doNotOptimize(doc.get("user").copyTo(user, sizeof(user)));
+        doNotOptimize(doc.get("enterprise").equals("true"));
+    }
+}
+
+BENCH(json_provision_msg) {
+    // As MqttProvision::handleMessage() reads it: one parse, two lookups
+    size_t len = strlen(PROVISION_MSG);
+    char bridgeId[64];
+    while (state.keepRunning()) {
+        JsonDoc doc;
+        doNotOptimize(doc.parse(PROVISION_MSG, len));
+        doNotOptimize(doc.get("type").equals("provision"));
+        doNotOptimize(doc.get("bridge_id").copyTo(bridgeId, sizeof(bridgeId)));
+    }
+}
+
+BENCH(json_missing_key) {
+    JsonDoc doc;
+    doc.parse(CONNECT_BODY, strlen(CONNECT_BODY));
+    while (state.keepRunning()) {
+        doNotOptimize(doc.get("identity").found());
+    }
+}
+
+struct CorpusFile {
+    std::string name;
+    std::string text;
+    bool        valid;
+};
+
+static void loadCorpusDir(const char* sub, bool valid, std::vector<CorpusFile>& files) {
+    std::string dirPath = std::string(CORPUS_DIR) + "/" + sub;
+    DIR* dir = opendir(dirPath.c_str());
+    if (!dir) return;
+    while (dirent* e = readdir(dir)) {
+        if (e->d_name[0] == '.') continue;
+        std::string path = dirPath + "/" + e->d_name;
+        FILE* f = fopen(path.c_str(), "rb");
+        if (!f) continue;
+        std::string text;
+        char buf[256];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0) text.append(buf, n);
+        fclose(f);
+        files.push_back({ std::string(sub) + "/" + e->d_name, text, valid });
+    }
+    closedir(dir);
+}
+
+static const std::vector<CorpusFile>& corpus() {
+    static std::vector<CorpusFile> files;
+    static bool loaded = false;
+    if (loaded) return files;
+    loaded = true;
+    loadCorpusDir("valid", true, files);
+    loadCorpusDir("invalid", false, files);
+    return files;
+}
+
+// Each op takes the next corpus entry, mutates a few bytes and maybe the
+// length (deterministically), and runs it through everything the firmware
+// calls. Should report 0 allocations per op; run under a sanitizer to
+// check bounds too. Every file is first parsed as is, and a file that
+// doesn't come out as its directory says fails the run.
+BENCH(json_corpus_fuzz) {
+    const std::vector<CorpusFile>& files = corpus();
+    if (files.empty()) {
+        fprintf(stderr, "json_corpus_fuzz: no files in %s (run from the repo root)\n", CORPUS_DIR);
+        while (state.keepRunning()) {}
+        return;
+    }
+    int wrong = 0;
+    for (const CorpusFile& file : files) {
+        JsonDoc doc;
+        if (doc.parse(file.text.data(), file.text.size()) == file.valid) continue;
+        fprintf(stderr, "json_corpus_fuzz: %s should %s\n", file.name.c_str(),
+                file.valid ? "parse" : "be rejected");
+        wrong++;
+    }
+    if (wrong) exit(1);
+
+    uint32_t rng = 0x9E3779B9;
+    auto next = [&rng]() {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        return rng;
+    };
+
+    char text[512];
+    char out[64];
+    size_t i = 0;
+    double parsed = 0;
+    while (state.keepRunning()) {
+        const std::string& src = files[i++ % files.size()].text;
+        size_t len = std::min(src.size(), sizeof(text));
+        memcpy(text, src.data(), len);
+        uint32_t r = next();
+        for (uint32_t k = 0; k < (r & 3) && len; k++) text[next() % len] = (char)next();
+        if (len && (r & 0x30) == 0) len = next() % len;
+
+        JsonDoc doc;
+        if (doc.parse(text, len)) {
+            parsed++;
+            doNotOptimize(doc.get("type").equals("provision"));
+            doNotOptimize(doc.get("bridge_id").copyTo(out, sizeof(out)));
+            for (uint8_t t = 0; t < doc.tokenCount(); t++) {
+                const JsonToken& tok = doc.token(t);
+                JsonView v;
+                v.data = text + tok.start;
+                v.len  = tok.end - tok.start;
+                v.type = tok.type;
+                if (tok.type == JsonType::STRING) doNotOptimize(v.copyTo(out, sizeof(out)));
+            }
+        }
+    }
+    state.counter("parsed", parsed);
+}
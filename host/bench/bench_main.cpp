@@ -0,0 +1,142 @@
+// Bench runner: bench [--filter SUBSTR] [--min-ms N]
+
+#include "bench.h"
+#include <Arduino.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+struct BenchEntry {
+    const char* name;
+    BenchFn fn;
+};
+
+static std::vector<BenchEntry>& registry() {
+    static std::vector<BenchEntry> r;
+    return r;
+}
+
+BenchRegistrar::BenchRegistrar(const char* name, BenchFn fn) {
+    registry().push_back({ name, fn });
+}
+
+static uint64_t nowNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// --- BenchState ---------------------------------------------------------------
+
+bool BenchState::keepRunning() {
+    if (!started_) {
+        started_ = true;
+        startAlloc_ = allocTotals();
+        startNs_ = nowNs();
+    }
+    if (done_ < target_) {
+        done_++;
+        return true;
+    }
+    elapsedNs_ += nowNs() - startNs_;
+    AllocStats a = allocTotals();
+    alloc_.count += a.count - startAlloc_.count;
+    alloc_.bytes += a.bytes - startAlloc_.bytes;
+    return false;
+}
+
+void BenchState::pause() {
+    if (paused_ || !started_) return;
+    paused_ = true;
+    elapsedNs_ += nowNs() - startNs_;
+    AllocStats a = allocTotals();
+    alloc_.count += a.count - startAlloc_.count;
+    alloc_.bytes += a.bytes - startAlloc_.bytes;
+}
+
+void BenchState::resume() {
+    if (!paused_) return;
+    paused_ = false;
+    startAlloc_ = allocTotals();
+    startNs_ = nowNs();
+}
+
+void BenchState::counter(const char* name, double total) {
+    for (int i = 0; i < MAX_COUNTERS; i++) {
+        if (!counterName_[i] || strcmp(counterName_[i], name) == 0) {
+            counterName_[i] = name;
+            counterTotal_[i] += total;
+            return;
+        }
+    }
+}
+
+// --- Runner -------------------------------------------------------------------
+
+class BenchRunner {
+public:
+    explicit BenchRunner(uint64_t minNs) : minNs_(minNs) {}
+
+    void run(const BenchEntry& e) {
+        // Grow the batch until it is long enough to time reliably
+        uint64_t n = 1;
+        for (;;) {
+            BenchState s(n);
+            e.fn(s);
+            if (s.elapsedNs_ >= minNs_ || n >= (1ull << 30)) {
+                report(e.name, s);
+                return;
+            }
+            uint64_t next = s.elapsedNs_ ? n * minNs_ * 12 / 10 / s.elapsedNs_ : n * 100;
+            n = std::max<uint64_t>(n * 2, std::min<uint64_t>(next, n * 100));
+        }
+    }
+
+private:
+    void report(const char* name, const BenchState& s) {
+        double n = (double)s.done_;
+        printf("%-32s %12llu %12.1f %10.2f %10.1f", name, (unsigned long long)s.done_,
+               s.elapsedNs_ / n, s.alloc_.count / n, s.alloc_.bytes / n);
+        for (int i = 0; i < BenchState::MAX_COUNTERS && s.counterName_[i]; i++) {
+            printf("  %s=%.2f/op", s.counterName_[i], s.counterTotal_[i] / n);
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+
+    uint64_t minNs_;
+};
+
+int main(int argc, char** argv) {
+    std::string filter;
+    uint64_t minMs = 200;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--min-ms" && i + 1 < argc) {
+            minMs = strtoull(argv[++i], nullptr, 10);
+        } else {
+            fprintf(stderr, "usage: %s [--filter SUBSTR] [--min-ms N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // Keep firmware logging out of the results table
+    Serial.hostRedirect(stderr);
+
+    printf("%-32s %12s %12s %10s %10s\n", "benchmark", "iterations", "ns/op", "allocs/op", "bytes/op");
+    // Registration order depends on link order; report alphabetically
+    std::vector<BenchEntry> entries = registry();
+    std::sort(entries.begin(), entries.end(), [](const BenchEntry& a, const BenchEntry& b) {
+        return strcmp(a.name, b.name) < 0;
+    });
+
+    BenchRunner runner(minMs * 1000000ull);
+    for (const BenchEntry& e : entries) {
+        if (!filter.empty() && std::string(e.name).find(filter) == std::string::npos) continue;
+        runner.run(e);
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include "bench.h"
+#include "mqtt/provision.h"
+
+static const char* CODE = "K7Q2MX";
+
+// Drives begin() -> connect -> subscribe -> publish against the host broker
+static void bringUp(MqttProvision& p) {
+    p.begin(CODE);
+    hostAdvanceMillis(5000);   // past the reconnect interval
+    for (int i = 0; i < 4; i++) p.loop();
+}
+
+BENCH(mqtt_provision_ack_roundtrip) {
+    MqttProvision p;
+    bringUp(p);
+    String topic = String("devices/claim/") + CODE;
+    const char* ack = "{\"type\":\"ack\",\"status\":\"registered\"}";
+    size_t len = strlen(ack);
+
+    while (state.keepRunning()) {
+        hostBrokerPublish(topic.c_str(), (const uint8_t*)ack, len);
+        p.loop();
+    }
+    p.stop();
+}
+
+BENCH(mqtt_provision_ignored_echo) {
+    // Our own register message echoes back on the claim topic
+    MqttProvision p;
+    bringUp(p);
+    String topic = String("devices/claim/") + CODE;
+    const char* echo = "{\"type\":\"register\",\"firmware_version\":\"" FIRMWARE_VERSION "\"}";
+    size_t len = strlen(echo);
+
+    while (state.keepRunning()) {
+        hostBrokerPublish(topic.c_str(), (const uint8_t*)echo, len);
+        p.loop();
+    }
+    p.stop();
+}
+
+BENCH(mqtt_client_publish) {
+    MqttClient c;
+    c.connect("bench");
+    const char* payload = "{\"type\":\"heartbeat\",\"uptime\":123456}";
+    while (state.keepRunning()) {
+        doNotOptimize(c.publish("devices/bench/state", payload));
+    }
+    c.disconnect();
+}
+
+static void countBytes(const char*, const char* payload, unsigned int length, void* ctx) {
+    doNotOptimize(payload);
+    *static_cast<uint64_t*>(ctx) += length;
+}
+
+BENCH(mqtt_client_receive_feed) {
+    // A steady score feed: only the client's receive path is counted, not
+    // the host broker queueing each message
+    MqttClient c;
+    uint64_t bytes = 0;
+    c.setCallback(countBytes, &bytes);
+    c.connect("feed");
+    c.subscribe("venues/main-gym/score");
+    const char* score = "{\"home\":54,\"away\":49,\"period\":3,\"clock\":\"04:12\"}";
+    size_t len = strlen(score);
+
+    while (state.keepRunning()) {
+        state.pause();
+        hostBrokerPublish("venues/main-gym/score", (const uint8_t*)score, len);
+        state.resume();
+        c.loop();
+    }
+    state.counter("bytes", (double)bytes);
+    c.disconnect();
+}
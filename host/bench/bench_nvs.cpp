@@ -0,0 +1,28 @@
+#include "bench.h"
+#include "nvs_manager.h"
+
+BENCH(nvs_get_string) {
+    NvsManager& nvs = NvsManager::instance();
+    nvs.registerNamespace("bench");
+    nvs.putString("bench", "ssid", "ScoreScrape-Guest");
+    while (state.keepRunning()) {
+        doNotOptimize(nvs.getString("bench", "ssid"));
+    }
+}
+
+BENCH(nvs_get_string_missing) {
+    NvsManager& nvs = NvsManager::instance();
+    nvs.registerNamespace("bench");
+    while (state.keepRunning()) {
+        doNotOptimize(nvs.getString("bench", "nope"));
+    }
+}
+
+BENCH(nvs_put_int) {
+    NvsManager& nvs = NvsManager::instance();
+    nvs.registerNamespace("bench");
+    int32_t v = 0;
+    while (state.keepRunning()) {
+        nvs.putInt("bench", "count", v++);
+    }
+}
@@ -0,0 +1,166 @@
+#include "bench.h"
+#include "touch_handler.h"
+#include "gesture_recognizer.h"
+#include "board_config.h"
+#include "axs5106l_sim.h"
+#include "touch_recorder.h"
+#include <freertos/task.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static AXS5106LSim& sim() {
+    static AXS5106LSim s(Wire, PIN_TP_INT);
+    return s;
+}
+
+static TouchHandler& handler() {
+    static TouchHandler h;
+    static bool started = false;
+    if (!started) {
+        sim();
+        started = h.begin();
+    }
+    return h;
+}
+
+static void drain(TouchHandler& h) {
+    TouchSample s;
+    while (h.readSample(s)) {}
+}
+
+BENCH(touch_poll_idle) {
+    // What loop() pays every pass with nobody touching the screen
+    TouchHandler& h = handler();
+    sim().release();
+    delay(5);
+    drain(h);
+    Wire.resetStats();
+    while (state.keepRunning()) {
+        doNotOptimize(h.detectGesture());
+    }
+    state.counter("i2c_bytes", Wire.stats().bytes);
+    state.counter("i2c_txn", Wire.stats().transactions);
+}
+
+// Counts the samples a pump takes off the queue, through the recorder hook,
+// and stops the run as soon as one pump takes more than one
+class OneSamplePerPump : public Print {
+public:
+    size_t write(uint8_t c) override {
+        if (c == '\n' && ++lines > 1) {
+            fprintf(stderr, "touch_poll_fallback_held: pump took more than one sample\n");
+            exit(1);
+        }
+        return 1;
+    }
+    uint32_t lines = 0;
+};
+
+BENCH(touch_poll_fallback_held) {
+    // No touch task, finger held: every loop() pass reads the controller
+    // once and gets back one sample, rather than staying in the pump until
+    // the lift
+    static TouchHandler h;
+    static OneSamplePerPump counter;
+    static TouchRecorder recorder;
+    static bool started = false;
+    if (!started) {
+        sim();
+        hostFailTaskCreates(1);
+        started = h.begin();
+        recorder.begin(counter);
+        h.setRecorder(&recorder);
+    }
+    sim().press(86, 160);
+    while (state.keepRunning()) {
+        counter.lines = 0;
+        doNotOptimize(h.detectGesture());
+        if (counter.lines != 1) {
+            fprintf(stderr, "touch_poll_fallback_held: no sample with the finger down\n");
+            exit(1);
+        }
+    }
+    sim().release();
+    counter.lines = 0;
+    h.detectGesture();
+}
+
+BENCH(touch_report_to_sample) {
+    // First contact: TP_INT edge -> touch task reads the report -> sample
+    // visible to loop()
+    TouchHandler& h = handler();
+    drain(h);
+    Wire.resetStats();
+    uint16_t y = 0;
+    TouchSample s;
+    while (state.keepRunning()) {
+        sim().press(86, 40 + (y++ & 0xFF));
+        while (!h.readSample(s)) {}
+        state.pause();
+        // The lift is picked up by the next fixed-rate sample
+        sim().release();
+        do {
+            while (!h.readSample(s)) {}
+        } while (s.data.count);
+        state.resume();
+    }
+}
+
+BENCH(touch_read_motion) {
+    // The UI's per-frame cost of reading the filtered position mid-drag
+    TouchHandler& h = handler();
+    sim().press(86, 160);
+    delay(20);
+    TouchMotion m;
+    while (state.keepRunning()) {
+        doNotOptimize(h.readMotion(m));
+    }
+    sim().release();
+    delay(20);
+    drain(h);
+}
+
+// The driver alone on the second bus, so the touch task stays out of it
+static void benchDriverRead(BenchState& state, AXS5106L::ReadMode mode, uint8_t points) {
+    static AXS5106LSim sim1(Wire1);
+    static AXS5106L driver(Wire1, -1);
+    driver.setReadMode(mode);
+    TouchPoint p[2] = { { 86, 160 }, { 40, 200 } };
+    if (points) sim1.press(p, points);
+    else        sim1.release();
+
+    Wire1.resetStats();
+    TouchData td;
+    while (state.keepRunning()) {
+        doNotOptimize(driver.read(td));
+    }
+    state.counter("i2c_bytes", Wire1.stats().bytes);
+    state.counter("i2c_stops", Wire1.stats().stops);
+}
+
+BENCH(touch_read_repeated_start_idle) { benchDriverRead(state, AXS5106L::ReadMode::REPEATED_START, 0); }
+BENCH(touch_read_repeated_start_1pt)  { benchDriverRead(state, AXS5106L::ReadMode::REPEATED_START, 1); }
+BENCH(touch_read_repeated_start_2pt)  { benchDriverRead(state, AXS5106L::ReadMode::REPEATED_START, 2); }
+BENCH(touch_read_split_1pt)           { benchDriverRead(state, AXS5106L::ReadMode::SPLIT, 1); }
+
+BENCH(gesture_feed_drag_sample) {
+    // Recognizer cost per 120 Hz sample of a drag, reading events as it goes
+    GestureRecognizer g;
+    TouchSample s = {};
+    s.data.count = 1;
+    GestureEvent e;
+    uint32_t i = 0;
+    while (state.keepRunning()) {
+        s.time_us += 8333;
+        if ((i & 63) == 63) {
+            s.data.count = 0;          // lift every 64 samples
+        } else {
+            s.data.count = 1;
+            s.data.points[0].x = 20 + (i & 63) * 4;
+            s.data.points[0].y = 86;
+        }
+        g.feed(s);
+        while (g.next(e)) doNotOptimize(e);
+        i++;
+    }
+}
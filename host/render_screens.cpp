@@ -0,0 +1,197 @@
+// Renders every screen on the host and reports what each would cost on the
+// panel bus.
+//
+//   render_screens [--out DIR] [--golden DIR] [--direct]
+//
+// Each scene is drawn through the real DisplayContext and screen code onto a
+// SoftPanel. Frames are written to DIR as <scene>.ppm and <scene>.png, and a
+// per-scene cost table goes to stdout and DIR/costs.csv. With --golden, frames
+// are compared against <scene>.ppm in that directory, and bus bytes against
+// its costs.csv. The exit status is non-zero on any pixel difference or on
+// more than COST_TOLERANCE growth in bus bytes. --direct disables the back
+// buffer to measure the unbuffered path.
+//
+// Before any scene, compile-time text metrics (staticText<>(), measure<>())
+// are checked against DisplayContext's runtime measurement for every font,
+// and any difference also fails the run: centred static labels would
+// otherwise drift silently after a font or generator change.
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <sys/stat.h>
+
+#include "soft_panel.h"
+#include "display_context.h"
+#include "font_metrics.h"
+#include "screens/boot_screen.h"
+#include "screens/connect_to_network_screen.h"
+#include "screens/onboarding_screen.h"
+#include "screens/home_screen.h"
+#include "screens/gesture_screen.h"
+
+static constexpr double COST_TOLERANCE = 0.02;
+
+static constexpr DisplayContext::StaticText TAPPED = staticText<DisplayContext::FONT_LARGE>("tapped");
+
+// Every StaticText label in the firmware, plus the whole printable range
+static const char* const METRIC_SAMPLES[] = {
+    "", " ", "tapped", "swiped", "testing", "scorescrape.io/dashboard",
+    "Connect to a Network", "WiFi Setup", "OR", "Ethernet", "Plug in cable",
+    "Waiting for dashboard...", "Hg jy, 0123456789",
+    " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`"
+    "abcdefghijklmnopqrstuvwxyz{|}~",
+};
+
+template <DisplayContext::Font F>
+static int checkMetrics(DisplayContext& dc, const char* fontName) {
+    int wrong = 0;
+    for (const char* text : METRIC_SAMPLES) {
+        TextBounds a = measure<typename FontMetricsFor<F>::type>(text);
+        TextBounds b = dc.getTextBounds(text, F);
+        if (a.x1 == b.x1 && a.y1 == b.y1 && a.w == b.w && a.h == b.h) continue;
+        fprintf(stderr, "metrics: %s \"%s\": compile-time %d,%d %ux%u, runtime %d,%d %ux%u\n",
+                fontName, text, a.x1, a.y1, a.w, a.h, b.x1, b.y1, b.w, b.h);
+        wrong++;
+    }
+    return wrong;
+}
+
+// One entry per FontMetricsFor specialization
+static int checkAllMetrics(DisplayContext& dc) {
+    return checkMetrics<DisplayContext::FONT_SMALL>(dc, "FONT_SMALL") +
+           checkMetrics<DisplayContext::FONT_MEDIUM>(dc, "FONT_MEDIUM") +
+           checkMetrics<DisplayContext::FONT_LARGE>(dc, "FONT_LARGE") +
+           checkMetrics<DisplayContext::FONT_XLARGE>(dc, "FONT_XLARGE") +
+           checkMetrics<DisplayContext::FONT_MONO>(dc, "FONT_MONO") +
+           checkMetrics<DisplayContext::FONT_MONO_SMALL>(dc, "FONT_MONO_SMALL");
+}
+
+struct Scene {
+    const char* name;
+    void (*draw)(DisplayContext& dc);
+};
+
+// Run in order, so later scenes start from the earlier frame just as they do
+// on the device (the boot logo is drawn once, the status strip on top of the
+// onboarding screen).
+static const Scene SCENES[] = {
+    { "boot",              [](DisplayContext& dc) { drawBootScreen(dc, "Starting..."); } },
+    { "boot_status",       [](DisplayContext& dc) { drawBootScreen(dc, "Connecting to \"ScoreScrape-Guest\""); } },
+    { "boot_progress",     [](DisplayContext& dc) { drawBootProgress(dc, 300); } },
+    { "connect",           [](DisplayContext& dc) { drawConnectToNetworkScreen(dc, "ScoreScrape-1A2B"); } },
+    { "onboarding",        [](DisplayContext& dc) { drawOnboardingScreen(dc, "K7Q-2MX"); } },
+    { "onboarding_status", [](DisplayContext& dc) { drawOnboardingStatus(dc, "Waiting for dashboard..."); } },
+    { "home",              [](DisplayContext& dc) { drawHomeScreen(dc); } },
+    { "gesture",           [](DisplayContext& dc) { drawGestureMessage(dc, TAPPED); } },
+};
+
+// scene -> bus bytes from a previous costs.csv
+static std::map<std::string, uint64_t> loadCosts(const std::string& path) {
+    std::map<std::string, uint64_t> costs;
+    FILE* f = fopen(path.c_str(), "r");
+    if (!f) return costs;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        char name[64];
+        unsigned long long calls, windows, pixels, bytes;
+        if (sscanf(line, "%63[^,],%llu,%llu,%llu,%llu", name, &calls, &windows, &pixels, &bytes) == 5) {
+            costs[name] = bytes;
+        }
+    }
+    fclose(f);
+    return costs;
+}
+
+int main(int argc, char** argv) {
+    std::string outDir = "frames";
+    std::string goldenDir;
+    bool direct = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--out" && i + 1 < argc) {
+            outDir = argv[++i];
+        } else if (arg == "--golden" && i + 1 < argc) {
+            goldenDir = argv[++i];
+        } else if (arg == "--direct") {
+            direct = true;
+        } else {
+            fprintf(stderr, "usage: %s [--out DIR] [--golden DIR] [--direct]\n", argv[0]);
+            return 2;
+        }
+    }
+    mkdir(outDir.c_str(), 0755);
+
+    // Same geometry as Display::begin(): portrait panel, landscape rotation
+    SoftPanel panel(172, 320);
+    panel.begin();
+    panel.setRotation(1);
+
+    int metricErrors;
+    {
+        // Its own context, so the text cache stats below are the scenes' only
+        DisplayContext metrics(&panel);
+        metricErrors = checkAllMetrics(metrics);
+    }
+    printf("text metrics: %s\n", metricErrors ? "MISMATCH" : "ok");
+
+    DisplayContext dc(&panel);
+    dc.enableDoubleBuffer(!direct);
+    panel.resetStats();
+
+    std::map<std::string, uint64_t> golden;
+    if (!goldenDir.empty()) golden = loadCosts(goldenDir + "/costs.csv");
+
+    FILE* csv = fopen((outDir + "/costs.csv").c_str(), "w");
+    if (!csv) {
+        fprintf(stderr, "cannot write %s/costs.csv\n", outDir.c_str());
+        return 2;
+    }
+    fprintf(csv, "scene,draw_calls,addr_windows,pixels,bus_bytes\n");
+
+    printf("%s\n", direct ? "direct" : "double buffered");
+    printf("%-18s %10s %12s %10s %10s  %s\n", "scene", "calls", "windows", "pixels", "bytes", "check");
+
+    int failures = 0;
+    for (const Scene& scene : SCENES) {
+        scene.draw(dc);
+        dc.waitForFlush();
+
+        SoftPanel::Stats s = panel.stats();
+        panel.resetStats();
+
+        std::string base = outDir + "/" + scene.name;
+        if (!panel.savePPM((base + ".ppm").c_str()) || !panel.savePNG((base + ".png").c_str())) {
+            fprintf(stderr, "cannot write %s.{ppm,png}\n", base.c_str());
+            return 2;
+        }
+        fprintf(csv, "%s,%u,%u,%llu,%llu\n", scene.name, s.drawCalls, s.addrWindows,
+                (unsigned long long)s.pixels, (unsigned long long)s.busBytes);
+
+        std::string check = "-";
+        if (!goldenDir.empty()) {
+            long diff = panel.diffPPM((goldenDir + "/" + scene.name + ".ppm").c_str());
+            auto it = golden.find(scene.name);
+            if (diff != 0) {
+                check = diff < 0 ? "no golden frame" : std::to_string(diff) + " px differ";
+                failures++;
+            } else if (it != golden.end() && s.busBytes > it->second * (1.0 + COST_TOLERANCE)) {
+                check = "bytes +" + std::to_string(s.busBytes - it->second);
+                failures++;
+            } else {
+                check = "ok";
+            }
+        }
+
+        printf("%-18s %10u %12u %10llu %10llu  %s\n", scene.name, s.drawCalls, s.addrWindows,
+               (unsigned long long)s.pixels, (unsigned long long)s.busBytes, check.c_str());
+    }
+    fclose(csv);
+
+    uint32_t hits, misses;
+    dc.getTextCacheStats(&hits, &misses);
+    printf("text cache: %u hits, %u misses\n", hits, misses);
+
+    return failures || metricErrors ? 1 : 0;
+}
@@ -0,0 +1,335 @@
+// Replays recorded touch traces through the gesture code under virtual time.
+//
+//   replay_touch [--loop-ms N] [--min-accuracy F] [-v] TRACE_OR_DIR...
+//
+// Traces are the text format written by TouchRecorder (touch_recorder.h).
+// Samples are fed to GestureClassifier (detectGesture()) and
+// GestureRecognizer (readGesture()) the way TouchHandler does, but on the
+// trace's own clock: loop() is modelled as draining the queue every
+// --loop-ms, so an event is seen at the first poll after the sample that
+// decided it (averaged over where the polls fall). A trace's "# expect:"
+// line lists the detectGesture() results it should produce, in order.
+//
+// A "# events:" line lists the readGesture() events it should produce,
+// DRAG and PINCH updates left out: how many of those there are depends on
+// how often loop() reads them, since unread ones merge. Events are read at
+// each poll, as loop() would, and have to match exactly at every poll
+// phase. The updates are checked instead for adding up: DRAG_START plus
+// every DRAG has to come to DRAG_END's offset, and PINCH_END has to repeat
+// the last PINCH.
+//
+// Reports per trace and overall classification accuracy, plus the time from
+// the lift to the event reaching loop() for release-decided gestures. Exits
+// non-zero if accuracy is below --min-accuracy (default 1.0), or if any
+// trace's events are wrong.
+
+#include <Arduino.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gesture_classifier.h"
+#include "gesture_recognizer.h"
+
+static const char* GESTURE_NAMES[] = {
+    "NONE", "TAP", "SWIPE_RIGHT_TO_LEFT", "SWIPE_LEFT_TO_RIGHT",
+    "SWIPE_TOP_TO_BOTTOM", "SWIPE_BOTTOM_TO_TOP"
+};
+
+static const char* EVENT_NAMES[] = {
+    "TAP", "DOUBLE_TAP", "LONG_PRESS", "DRAG_START", "DRAG", "DRAG_END",
+    "FLING", "PINCH_START", "PINCH", "PINCH_END"
+};
+
+struct Trace {
+    std::string path;
+    std::vector<std::string> expect;
+    std::vector<std::string> events;
+    bool has_events = false;
+    std::vector<TouchSample> samples;
+};
+
+struct Result {
+    std::vector<std::string> got;
+    std::vector<std::string> events;   // recognizer, DRAG/PINCH updates left out
+    std::vector<uint32_t> latency_us;  // lift -> seen by loop()
+    std::string error;                 // first DRAG/PINCH update that didn't add up
+    size_t matched = 0;
+};
+
+static std::vector<std::string> split(const char* s) {
+    std::vector<std::string> out;
+    const char* p = s;
+    while (*p) {
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+        const char* start = p;
+        while (*p && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') p++;
+        if (p > start) out.emplace_back(start, p - start);
+    }
+    return out;
+}
+
+static bool loadTrace(const std::string& path, Trace& t) {
+    FILE* f = fopen(path.c_str(), "r");
+    if (!f) return false;
+    t.path = path;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        if (strncmp(line, "# expect:", 9) == 0) {
+            t.expect = split(line + 9);
+            continue;
+        }
+        if (strncmp(line, "# events:", 9) == 0) {
+            t.events = split(line + 9);
+            t.has_events = true;
+            continue;
+        }
+        if (strncmp(line, "@t ", 3) != 0) continue;
+
+        unsigned long time_us;
+        unsigned count, x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+        int n = sscanf(line + 3, "%lu %u %u %u %u %u", &time_us, &count, &x0, &y0, &x1, &y1);
+        if (n < 2 || count > AXS5106L_MAX_POINTS || n < 2 + (int)count * 2) continue;
+        TouchSample s = {};
+        s.time_us = (uint32_t)time_us;
+        s.data.count = count;
+        s.data.points[0] = { (uint16_t)x0, (uint16_t)y0 };
+        s.data.points[1] = { (uint16_t)x1, (uint16_t)y1 };
+        t.samples.push_back(s);
+    }
+    fclose(f);
+    return true;
+}
+
+static void collect(const std::string& path, std::vector<std::string>& out) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+        fprintf(stderr, "%s: not found\n", path.c_str());
+        return;
+    }
+    if (!S_ISDIR(st.st_mode)) {
+        out.push_back(path);
+        return;
+    }
+    DIR* d = opendir(path.c_str());
+    if (!d) return;
+    std::vector<std::string> entries;
+    while (dirent* e = readdir(d)) {
+        if (e->d_name[0] == '.') continue;
+        entries.push_back(path + "/" + e->d_name);
+    }
+    closedir(d);
+    std::sort(entries.begin(), entries.end());
+    for (const std::string& e : entries) {
+        size_t len = e.size();
+        if (len > 6 && e.compare(len - 6, 6, ".trace") == 0) out.push_back(e);
+        else if (stat(e.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) collect(e, out);
+    }
+}
+
+// Longest common subsequence, so one spurious or missed gesture costs one
+// match instead of shifting everything after it
+static size_t lcs(const std::vector<std::string>& a, const std::vector<std::string>& b) {
+    std::vector<size_t> prev(b.size() + 1, 0), cur(b.size() + 1, 0);
+    for (size_t i = 1; i <= a.size(); i++) {
+        for (size_t j = 1; j <= b.size(); j++) {
+            cur[j] = a[i - 1] == b[j - 1] ? prev[j - 1] + 1 : std::max(prev[j], cur[j - 1]);
+        }
+        std::swap(prev, cur);
+    }
+    return prev[b.size()];
+}
+
+// Where the first poll falls relative to the first sample is arbitrary, so
+// latency is averaged over this many evenly spaced phases
+static constexpr int PHASES = 8;
+
+// Running totals of the DRAG/PINCH updates read so far, checked against
+// the event that ends the gesture
+struct UpdateCheck {
+    int32_t drag_dx = 0, drag_dy = 0;
+    float   pinch_scale = 1.0f, pinch_rotation = 0.0f;
+
+    void read(const GestureEvent& e, std::string& error) {
+        char msg[96];
+        switch (e.type) {
+        case GestureEventType::DRAG_START:
+            drag_dx = e.dx;
+            drag_dy = e.dy;
+            break;
+        case GestureEventType::DRAG:
+            drag_dx += e.dx;
+            drag_dy += e.dy;
+            break;
+        case GestureEventType::DRAG_END:
+            if (error.empty() && (drag_dx != e.dx || drag_dy != e.dy)) {
+                snprintf(msg, sizeof(msg), "drags add up to %d,%d, DRAG_END says %d,%d",
+                         (int)drag_dx, (int)drag_dy, e.dx, e.dy);
+                error = msg;
+            }
+            break;
+        case GestureEventType::PINCH_START:
+            pinch_scale = 1.0f;
+            pinch_rotation = 0.0f;
+            break;
+        case GestureEventType::PINCH:
+            pinch_scale = e.scale;
+            pinch_rotation = e.rotation;
+            break;
+        case GestureEventType::PINCH_END:
+            if (error.empty() && (pinch_scale != e.scale || pinch_rotation != e.rotation)) {
+                snprintf(msg, sizeof(msg), "last PINCH %.3f/%.3f, PINCH_END %.3f/%.3f",
+                         pinch_scale, pinch_rotation, e.scale, e.rotation);
+                error = msg;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+};
+
+static Result replay(const Trace& t, uint32_t loop_us, uint32_t phase_us) {
+    Result r;
+    GestureClassifier classifier;
+    GestureRecognizer recognizer;
+    UpdateCheck updates;
+    if (t.samples.empty()) return r;
+
+    uint32_t poll = t.samples.front().time_us + phase_us;
+    size_t next = 0;
+    uint32_t lift_us = 0;
+    std::vector<uint32_t> pending;   // lift times of gestures not yet polled
+
+    while (next < t.samples.size()) {
+        // Everything the touch task queued before this poll
+        while (next < t.samples.size() && (int32_t)(t.samples[next].time_us - poll) <= 0) {
+            const TouchSample& s = t.samples[next++];
+            if (s.data.count == 0) lift_us = s.time_us;
+
+            GestureType g = classifier.feed(s);
+            if (g != GestureType::NONE) {
+                r.got.push_back(GESTURE_NAMES[(int)g]);
+                pending.push_back(lift_us);
+            }
+            recognizer.feed(s);
+        }
+        GestureEvent e;
+        while (recognizer.next(e)) {
+            updates.read(e, r.error);
+            if (e.type == GestureEventType::DRAG || e.type == GestureEventType::PINCH) continue;
+            r.events.push_back(EVENT_NAMES[(int)e.type]);
+        }
+        for (uint32_t lift : pending) r.latency_us.push_back(poll - lift);
+        pending.clear();
+        poll += loop_us;
+    }
+    r.matched = lcs(t.expect, r.got);
+    return r;
+}
+
+static std::string join(const std::vector<std::string>& v) {
+    std::string out;
+    for (const std::string& s : v) {
+        if (!out.empty()) out += ' ';
+        out += s;
+    }
+    return out.empty() ? "-" : out;
+}
+
+int main(int argc, char** argv) {
+    uint32_t loopMs = 10;
+    double minAccuracy = 1.0;
+    bool verbose = false;
+    std::vector<std::string> paths;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--loop-ms" && i + 1 < argc) {
+            loopMs = strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--min-accuracy" && i + 1 < argc) {
+            minAccuracy = atof(argv[++i]);
+        } else if (arg == "-v") {
+            verbose = true;
+        } else if (arg[0] == '-') {
+            fprintf(stderr, "usage: %s [--loop-ms N] [--min-accuracy F] [-v] TRACE_OR_DIR...\n", argv[0]);
+            return 2;
+        } else {
+            collect(arg, paths);
+        }
+    }
+    if (paths.empty()) {
+        fprintf(stderr, "no traces\n");
+        return 2;
+    }
+
+    printf("%-40s %8s %5s %7s %10s %10s %7s\n", "trace", "expected", "got", "matched", "mean ms", "max ms", "events");
+    size_t totalExpected = 0, totalScored = 0, totalMatched = 0, eventFailures = 0;
+    std::vector<uint32_t> allLatency;
+
+    for (const std::string& path : paths) {
+        Trace t;
+        if (!loadTrace(path, t)) {
+            fprintf(stderr, "%s: can't read\n", path.c_str());
+            continue;
+        }
+        uint32_t loopUs = loopMs * 1000;
+        Result r = replay(t, loopUs, 0);
+        // Events have to come out the same wherever the polls fall
+        std::string eventError = r.error;
+        if (eventError.empty() && t.has_events && r.events != t.events) eventError = "wrong events";
+        for (int p = 1; p < PHASES; p++) {
+            Result rp = replay(t, loopUs, loopUs * p / PHASES);
+            r.latency_us.insert(r.latency_us.end(), rp.latency_us.begin(), rp.latency_us.end());
+            if (!eventError.empty()) continue;
+            if (!rp.error.empty()) {
+                eventError = rp.error;
+            } else if (t.has_events && rp.events != t.events) {
+                eventError = "wrong events at phase " + std::to_string(p) + "/" + std::to_string(PHASES) +
+                             ": " + join(rp.events);
+            }
+        }
+        const char* eventStatus = !eventError.empty() ? "FAIL" : t.has_events ? "ok" : "-";
+
+        double mean = 0, worst = 0;
+        for (uint32_t us : r.latency_us) {
+            mean += us / 1000.0;
+            worst = std::max(worst, us / 1000.0);
+        }
+        if (!r.latency_us.empty()) mean /= r.latency_us.size();
+        allLatency.insert(allLatency.end(), r.latency_us.begin(), r.latency_us.end());
+
+        std::string name = path.size() > 40 ? "..." + path.substr(path.size() - 37) : path;
+        printf("%-40s %8zu %5zu %7zu %10.1f %10.1f %7s%s\n", name.c_str(), t.expect.size(), r.got.size(),
+               r.matched, mean, worst, eventStatus,
+               r.matched == std::max(t.expect.size(), r.got.size()) ? "" : "  MISMATCH");
+        if (verbose || r.matched != std::max(t.expect.size(), r.got.size())) {
+            printf("    expect: %s\n    got:    %s\n", join(t.expect).c_str(), join(r.got).c_str());
+        }
+        if (!eventError.empty()) {
+            eventFailures++;
+            if (t.has_events) printf("    expect events: %s\n", join(t.events).c_str());
+            printf("    events: %s\n    %s\n", join(r.events).c_str(), eventError.c_str());
+        } else if (verbose) {
+            printf("    events: %s\n", join(r.events).c_str());
+        }
+
+        totalExpected += t.expect.size();
+        totalScored += std::max(t.expect.size(), r.got.size());
+        totalMatched += r.matched;
+    }
+
+    std::sort(allLatency.begin(), allLatency.end());
+    double accuracy = totalScored ? (double)totalMatched / totalScored : 1.0;
+    printf("\n%zu traces, %zu gestures expected, accuracy %.1f%%", paths.size(), totalExpected, accuracy * 100);
+    if (!allLatency.empty()) {
+        printf(", lift->loop p50 %.1f ms p95 %.1f ms",
+               allLatency[allLatency.size() / 2] / 1000.0,
+               allLatency[std::min(allLatency.size() - 1, allLatency.size() * 95 / 100)] / 1000.0);
+    }
+    printf("\n");
+    if (eventFailures) printf("%zu traces with wrong gesture events\n", eventFailures);
+    return accuracy + 1e-9 < minAccuracy || eventFailures ? 1 : 0;
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+// Minimal Arduino core for host builds (env:native).
+//
+// Only what the firmware modules compiled on the host actually touch;
+// timing is real (steady clock), Serial goes to stdout.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <algorithm>
+#include <cmath>
+#include "WString.h"
+
+// Arduino-ESP32 3.x pulls these in instead of the old macros
+using std::min;
+using std::max;
+using std::abs;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH         0x1
+#define LOW          0x0
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+#define RISING       0x01
+#define FALLING      0x02
+#define CHANGE       0x03
+#define ONLOW        0x04
+
+#define PROGMEM
+#define IRAM_ATTR
+#define pgm_read_byte(addr)    (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)    (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr)   (*(const uint32_t*)(addr))
+#define pgm_read_pointer(addr) (*(void* const*)(addr))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+// Host only: moves millis()/micros() forward without sleeping, to get past
+// retry intervals and timeouts
+void hostAdvanceMillis(unsigned long ms);
+
+// GPIO: outputs are latched, inputs read back the latch (or HIGH) so
+// active-low buttons and interrupt lines idle released
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+void attachInterruptArg(uint8_t pin, void (*isr)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t pin);
+inline uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+// Host only: runs the handler attached to 'pin', as if the edge fired
+void hostRaiseInterrupt(uint8_t pin);
+
+inline void* ps_malloc(size_t size) { return malloc(size); }
+inline bool psramFound() { return true; }
+
+class Print {
+public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buf, size_t len) {
+        size_t n = 0;
+        while (len--) n += write(*buf++);
+        return n;
+    }
+
+    size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+    size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(long v) { return printf("%ld", v); }
+    size_t print(unsigned long v) { return printf("%lu", v); }
+    size_t print(int v) { return print((long)v); }
+    size_t print(unsigned int v) { return print((unsigned long)v); }
+    size_t println() { return print("\n"); }
+    template <typename T>
+    size_t println(T v) { size_t n = print(v); return n + println(); }
+
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        char buf[256];
+        va_list ap;
+        va_start(ap, fmt);
+        int len = vsnprintf(buf, sizeof(buf), fmt, ap);
+        va_end(ap);
+        if (len < 0) return 0;
+        return write((const uint8_t*)buf, std::min<size_t>(len, sizeof(buf) - 1));
+    }
+};
+
+class HostSerial : public Print {
+public:
+    void begin(unsigned long) {}
+    void flush() { fflush(out_); }
+    size_t write(uint8_t c) override { return fputc(c, out_) == EOF ? 0 : 1; }
+    size_t write(const uint8_t* buf, size_t len) override { return fwrite(buf, 1, len, out_); }
+    operator bool() const { return true; }
+
+    // Host only: where firmware logging goes (stdout by default)
+    void hostRedirect(FILE* f) { out_ = f; }
+
+private:
+    FILE* out_ = stdout;
+};
+
+extern HostSerial Serial;
@@ -0,0 +1,112 @@
+#pragma once
+
+// Arduino_GFX subset for host builds (env:native).
+//
+// Same class names, signatures and primitive algorithms as GFX Library for
+// Arduino 1.5.x, restricted to what the firmware uses. Every drawing call
+// bottoms out in writePixelPreclipped(), writeFillRectPreclipped() or
+// draw16bitRGBBitmap(), which is where a backend (Arduino_Canvas here,
+// SoftPanel in host/) plugs in. Only rotation 0 is modelled for canvases.
+
+#include <Arduino.h>
+
+#define GFX_NOT_DEFINED       -1
+#define GFX_SKIP_OUTPUT_BEGIN -2
+
+typedef struct {
+    uint16_t bitmapOffset;
+    uint8_t  width;
+    uint8_t  height;
+    uint8_t  xAdvance;
+    int8_t   xOffset;
+    int8_t   yOffset;
+} GFXglyph;
+
+typedef struct {
+    uint8_t*  bitmap;
+    GFXglyph* glyph;
+    uint16_t  first;
+    uint16_t  last;
+    uint8_t   yAdvance;
+} GFXfont;
+
+class Arduino_GFX : public Print {
+public:
+    Arduino_GFX(int16_t w, int16_t h);
+    virtual ~Arduino_GFX() = default;
+
+    virtual bool begin(int32_t speed = GFX_NOT_DEFINED) = 0;
+    virtual void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) = 0;
+    virtual void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) = 0;
+    virtual void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h);
+    virtual void startWrite() {}
+    virtual void endWrite() {}
+    virtual void setRotation(uint8_t r);
+    virtual void invertDisplay(bool) {}
+    virtual void flush() {}
+
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+    uint8_t getRotation() const { return _rotation; }
+
+    void writePixel(int16_t x, int16_t y, uint16_t color);
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void fillScreen(uint16_t color);
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+
+    void setFont(const GFXfont* f) { _font = f; }
+    void setCursor(int16_t x, int16_t y) { _cursorX = x; _cursorY = y; }
+    void setTextColor(uint16_t c) { _textColor = c; _textBgColor = c; }
+    void setTextColor(uint16_t c, uint16_t bg) { _textColor = c; _textBgColor = bg; }
+    void getTextBounds(const char* str, int16_t x, int16_t y,
+                       int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
+
+    // Print: renders with the current GFXfont at the cursor
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+protected:
+    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners,
+                          int16_t delta, uint16_t color);
+
+    int16_t WIDTH, HEIGHT;
+    int16_t _width, _height;
+    uint8_t _rotation = 0;
+
+    const GFXfont* _font = nullptr;
+    int16_t  _cursorX = 0;
+    int16_t  _cursorY = 0;
+    uint16_t _textColor = 0xFFFF;
+    uint16_t _textBgColor = 0xFFFF;
+};
+
+class Arduino_Canvas : public Arduino_GFX {
+public:
+    Arduino_Canvas(int16_t w, int16_t h, Arduino_GFX* output,
+                   int16_t output_x = 0, int16_t output_y = 0, uint8_t rotation = 0);
+    ~Arduino_Canvas() override;
+
+    bool begin(int32_t speed = GFX_NOT_DEFINED) override;
+    void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+    void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) override;
+    void flush() override;
+
+    uint16_t* getFramebuffer() { return _framebuffer; }
+
+protected:
+    uint16_t*    _framebuffer = nullptr;
+    Arduino_GFX* _output;
+    int16_t      _output_x, _output_y;
+};
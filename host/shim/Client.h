@@ -0,0 +1,4 @@
+#pragma once
+
+// Client lives in WiFi.h on the host; real cores give it its own header
+#include <WiFi.h>
@@ -0,0 +1,71 @@
+#include <LittleFS.h>
+#include <sys/stat.h>
+
+using namespace fs;
+
+int File::available() {
+    if (!f_) return 0;
+    long pos = ftell(f_.get());
+    return (int)(size() - pos);
+}
+
+size_t File::size() const {
+    if (!f_) return 0;
+    struct stat st;
+    return fstat(fileno(f_.get()), &st) == 0 ? (size_t)st.st_size : 0;
+}
+
+String File::readString() {
+    String s;
+    int c;
+    while ((c = read()) >= 0) s += (char)c;
+    return s;
+}
+
+const char* File::name() const {
+    const char* slash = strrchr(path_.c_str(), '/');
+    return slash ? slash + 1 : path_.c_str();
+}
+
+String FS::resolve(const char* path) const {
+    String full = root_;
+    if (path[0] != '/') full += '/';
+    full += path;
+    return full;
+}
+
+File FS::open(const char* path, const char* mode, bool) {
+    String full = resolve(path);
+    struct stat st;
+    if (mode[0] == 'r' && (stat(full.c_str(), &st) != 0 || S_ISDIR(st.st_mode))) return File();
+    // Binary so sizes and offsets match the device
+    String m = mode;
+    if (m.indexOf('b') < 0) m += 'b';
+    FILE* f = fopen(full.c_str(), m.c_str());
+    return f ? File(f, path) : File();
+}
+
+bool FS::exists(const char* path) {
+    struct stat st;
+    return stat(resolve(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char* path) {
+    return ::remove(resolve(path).c_str()) == 0;
+}
+
+bool FS::rename(const char* from, const char* to) {
+    return ::rename(resolve(from).c_str(), resolve(to).c_str()) == 0;
+}
+
+LittleFSFS LittleFS;
+
+LittleFSFS::LittleFSFS() : FS("data") {
+}
+
+bool LittleFSFS::begin(bool, const char*, uint8_t, const char*) {
+    const char* root = getenv("LITTLEFS_ROOT");
+    if (root && *root) setRoot(root);
+    struct stat st;
+    return stat(root_.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
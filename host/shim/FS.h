@@ -0,0 +1,60 @@
+#pragma once
+
+// Arduino FS on a host directory. Paths are relative to the mount root.
+
+#include <Arduino.h>
+#include <memory>
+
+namespace fs {
+
+class File : public Print {
+public:
+    File() = default;
+    File(FILE* f, const String& path) : f_(f, fclose), path_(path) {}
+
+    explicit operator bool() const { return f_ != nullptr; }
+    size_t write(uint8_t c) override { return f_ && fputc(c, f_.get()) != EOF ? 1 : 0; }
+    size_t write(const uint8_t* buf, size_t len) override { return f_ ? fwrite(buf, 1, len, f_.get()) : 0; }
+    int available();
+    int read() { int c = f_ ? fgetc(f_.get()) : EOF; return c == EOF ? -1 : c; }
+    size_t read(uint8_t* buf, size_t len) { return f_ ? fread(buf, 1, len, f_.get()) : 0; }
+    size_t readBytes(char* buf, size_t len) { return read((uint8_t*)buf, len); }
+    String readString();
+    bool seek(uint32_t pos) { return f_ && fseek(f_.get(), pos, SEEK_SET) == 0; }
+    size_t position() const { return f_ ? (size_t)ftell(f_.get()) : 0; }
+    size_t size() const;
+    void flush() { if (f_) fflush(f_.get()); }
+    void close() { f_.reset(); }
+    const char* path() const { return path_.c_str(); }
+    const char* name() const;
+
+private:
+    std::shared_ptr<FILE> f_;
+    String path_;
+};
+
+class FS {
+public:
+    explicit FS(const char* root) : root_(root) {}
+
+    File open(const char* path, const char* mode = "r", bool create = false);
+    File open(const String& path, const char* mode = "r", bool create = false) {
+        return open(path.c_str(), mode, create);
+    }
+    bool exists(const char* path);
+    bool exists(const String& path) { return exists(path.c_str()); }
+    bool remove(const char* path);
+    bool rename(const char* from, const char* to);
+
+    // Host only: point the mount at another directory
+    void setRoot(const char* root) { root_ = root; }
+
+protected:
+    String resolve(const char* path) const;
+    String root_;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
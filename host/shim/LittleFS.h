@@ -0,0 +1,19 @@
+#pragma once
+
+// LittleFS mounted on the project's data/ directory (the filesystem image
+// source), or $LITTLEFS_ROOT when set.
+
+#include <FS.h>
+
+class LittleFSFS : public fs::FS {
+public:
+    LittleFSFS();
+    bool begin(bool formatOnFail = false, const char* basePath = "/littlefs",
+               uint8_t maxOpenFiles = 10, const char* partitionLabel = "spiffs");
+    void end() {}
+    bool format() { return false; }
+    size_t totalBytes() { return 1024 * 1024; }
+    size_t usedBytes() { return 0; }
+};
+
+extern LittleFSFS LittleFS;
@@ -0,0 +1,182 @@
+#include <Preferences.h>
+#include <nvs_flash.h>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum class Type { INT, UINT, INT64, UINT64, STR, BLOB };
+
+struct Entry {
+    Type type;
+    int64_t i;
+    uint64_t u;
+    std::vector<uint8_t> bytes;   // string (with NUL) or blob
+};
+
+using Namespace = std::map<std::string, Entry>;
+
+std::mutex store_lock;
+std::map<std::string, Namespace> store;
+
+// NVS limits: 15-character names, 4000-byte strings
+constexpr size_t MAX_NAME = 15;
+constexpr size_t MAX_STRING = 4000;
+
+bool validKey(const char* key) {
+    return key && *key && strlen(key) <= MAX_NAME;
+}
+
+} // namespace
+
+bool Preferences::begin(const char* name, bool readOnly, const char*) {
+    if (started_ || !validKey(name)) return false;
+    std::lock_guard<std::mutex> lk(store_lock);
+    if (readOnly && !store.count(name)) return false;   // NOT_FOUND, like NVS
+    store[name];
+    ns_ = name;
+    readOnly_ = readOnly;
+    started_ = true;
+    return true;
+}
+
+void Preferences::end() {
+    started_ = false;
+}
+
+bool Preferences::clear() {
+    if (!writable()) return false;
+    std::lock_guard<std::mutex> lk(store_lock);
+    store[ns_.c_str()].clear();
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!writable()) return false;
+    std::lock_guard<std::mutex> lk(store_lock);
+    return store[ns_.c_str()].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+    if (!started_ || !key) return false;
+    std::lock_guard<std::mutex> lk(store_lock);
+    return store[ns_.c_str()].count(key) > 0;
+}
+
+// --- Put -----------------------------------------------------------------------
+
+#define PUT(key, ...)                                      \
+    if (!writable() || !validKey(key)) return 0;           \
+    std::lock_guard<std::mutex> lk(store_lock);            \
+    store[ns_.c_str()][key] = Entry{ __VA_ARGS__ };
+
+size_t Preferences::putInt(const char* key, int32_t value) {
+    PUT(key, Type::INT, value, 0, {});
+    return 4;
+}
+
+size_t Preferences::putUInt(const char* key, uint32_t value) {
+    PUT(key, Type::UINT, 0, value, {});
+    return 4;
+}
+
+size_t Preferences::putLong64(const char* key, int64_t value) {
+    PUT(key, Type::INT64, value, 0, {});
+    return 8;
+}
+
+size_t Preferences::putULong64(const char* key, uint64_t value) {
+    PUT(key, Type::UINT64, 0, value, {});
+    return 8;
+}
+
+size_t Preferences::putString(const char* key, const char* value) {
+    if (!value) return 0;
+    size_t len = strlen(value);
+    if (len + 1 > MAX_STRING) return 0;
+    PUT(key, Type::STR, 0, 0, std::vector<uint8_t>(value, value + len + 1));
+    return len;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+    if (!value || !len) return 0;
+    const uint8_t* p = static_cast<const uint8_t*>(value);
+    PUT(key, Type::BLOB, 0, 0, std::vector<uint8_t>(p, p + len));
+    return len;
+}
+
+#undef PUT
+
+// --- Get -----------------------------------------------------------------------
+
+static const Entry* find(const String& ns, const char* key, Type type) {
+    auto n = store.find(ns.c_str());
+    if (n == store.end() || !key) return nullptr;
+    auto e = n->second.find(key);
+    if (e == n->second.end() || e->second.type != type) return nullptr;
+    return &e->second;
+}
+
+int32_t Preferences::getInt(const char* key, int32_t defaultValue) {
+    std::lock_guard<std::mutex> lk(store_lock);
+    const Entry* e = started_ ? find(ns_, key, Type::INT) : nullptr;
+    return e ? (int32_t)e->i : defaultValue;
+}
+
+uint32_t Preferences::getUInt(const char* key, uint32_t defaultValue) {
+    std::lock_guard<std::mutex> lk(store_lock);
+    const Entry* e = started_ ? find(ns_, key, Type::UINT) : nullptr;
+    return e ? (uint32_t)e->u : defaultValue;
+}
+
+int64_t Preferences::getLong64(const char* key, int64_t defaultValue) {
+    std::lock_guard<std::mutex> lk(store_lock);
+    const Entry* e = started_ ? find(ns_, key, Type::INT64) : nullptr;
+    return e ? e->i : defaultValue;
+}
+
+uint64_t Preferences::getULong64(const char* key, uint64_t defaultValue) {
+    std::lock_guard<std::mutex> lk(store_lock);
+    const Entry* e = started_ ? find(ns_, key, Type::UINT64) : nullptr;
+    return e ? e->u : defaultValue;
+}
+
+String Preferences::getString(const char* key, String defaultValue) {
+    std::lock_guard<std::mutex> lk(store_lock);
+    const Entry* e = started_ ? find(ns_, key, Type::STR) : nullptr;
+    return e ? String((const char*)e->bytes.data()) : defaultValue;
+}
+
+size_t Preferences::getString(const char* key, char* value, size_t maxLen) {
+    std::lock_guard<std::mutex> lk(store_lock);
+    const Entry* e = started_ ? find(ns_, key, Type::STR) : nullptr;
+    if (!e || !value || e->bytes.size() > maxLen) return 0;
+    memcpy(value, e->bytes.data(), e->bytes.size());
+    return e->bytes.size();
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    std::lock_guard<std::mutex> lk(store_lock);
+    const Entry* e = started_ ? find(ns_, key, Type::BLOB) : nullptr;
+    return e ? e->bytes.size() : 0;
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+    std::lock_guard<std::mutex> lk(store_lock);
+    const Entry* e = started_ ? find(ns_, key, Type::BLOB) : nullptr;
+    if (!e || !buf || e->bytes.size() > maxLen) return 0;
+    memcpy(buf, e->bytes.data(), e->bytes.size());
+    return e->bytes.size();
+}
+
+void hostPreferencesReset() {
+    std::lock_guard<std::mutex> lk(store_lock);
+    store.clear();
+}
+
+esp_err_t nvs_flash_erase() {
+    hostPreferencesReset();
+    return ESP_OK;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+// ESP32 Preferences on an in-memory store shared by every instance, so
+// namespaces survive across begin()/end() just as they do in NVS. Keys are
+// typed like NVS: reading with the wrong getter returns the default.
+
+#include <Arduino.h>
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false, const char* partition = nullptr);
+    void end();
+
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+    size_t freeEntries() { return 1000; }
+
+    size_t putChar(const char* key, int8_t value)         { return putInt(key, value) ? 1 : 0; }
+    size_t putUChar(const char* key, uint8_t value)       { return putUInt(key, value) ? 1 : 0; }
+    size_t putShort(const char* key, int16_t value)       { return putInt(key, value) ? 2 : 0; }
+    size_t putUShort(const char* key, uint16_t value)     { return putUInt(key, value) ? 2 : 0; }
+    size_t putInt(const char* key, int32_t value);
+    size_t putUInt(const char* key, uint32_t value);
+    size_t putLong(const char* key, int32_t value)        { return putInt(key, value); }
+    size_t putULong(const char* key, uint32_t value)      { return putUInt(key, value); }
+    size_t putLong64(const char* key, int64_t value);
+    size_t putULong64(const char* key, uint64_t value);
+    size_t putBool(const char* key, bool value)           { return putUChar(key, value ? 1 : 0); }
+    size_t putString(const char* key, const char* value);
+    size_t putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+    size_t putBytes(const char* key, const void* value, size_t len);
+
+    int8_t   getChar(const char* key, int8_t defaultValue = 0)       { return (int8_t)getInt(key, defaultValue); }
+    uint8_t  getUChar(const char* key, uint8_t defaultValue = 0)     { return (uint8_t)getUInt(key, defaultValue); }
+    int16_t  getShort(const char* key, int16_t defaultValue = 0)     { return (int16_t)getInt(key, defaultValue); }
+    uint16_t getUShort(const char* key, uint16_t defaultValue = 0)   { return (uint16_t)getUInt(key, defaultValue); }
+    int32_t  getInt(const char* key, int32_t defaultValue = 0);
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0);
+    int32_t  getLong(const char* key, int32_t defaultValue = 0)      { return getInt(key, defaultValue); }
+    uint32_t getULong(const char* key, uint32_t defaultValue = 0)    { return getUInt(key, defaultValue); }
+    int64_t  getLong64(const char* key, int64_t defaultValue = 0);
+    uint64_t getULong64(const char* key, uint64_t defaultValue = 0);
+    bool     getBool(const char* key, bool defaultValue = false)     { return getUChar(key, defaultValue ? 1 : 0) != 0; }
+    String   getString(const char* key, String defaultValue = String());
+    size_t   getString(const char* key, char* value, size_t maxLen);
+    size_t   getBytesLength(const char* key);
+    size_t   getBytes(const char* key, void* buf, size_t maxLen);
+
+private:
+    bool writable() const { return started_ && !readOnly_; }
+
+    String ns_;
+    bool started_ = false;
+    bool readOnly_ = false;
+};
+
+// Host only: forget every namespace (a freshly erased NVS partition)
+void hostPreferencesReset();
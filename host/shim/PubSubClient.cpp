@@ -0,0 +1,190 @@
+#include <PubSubClient.h>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct HostBroker {
+    struct Message {
+        std::string topic;
+        std::vector<uint8_t> payload;
+    };
+    struct Session {
+        std::vector<std::string> filters;
+        std::deque<Message> inbox;
+    };
+
+    std::mutex lock;
+    std::map<PubSubClient*, Session> sessions;   // connected clients
+    bool online = true;
+    uint32_t published = 0;
+
+    static bool matches(const std::string& filter, const std::string& topic) {
+        if (!filter.empty() && filter.back() == '#') {
+            return topic.compare(0, filter.size() - 1, filter, 0, filter.size() - 1) == 0;
+        }
+        return filter == topic;
+    }
+
+    void route(const char* topic, const uint8_t* payload, unsigned int length) {
+        for (auto& s : sessions) {
+            for (const std::string& f : s.second.filters) {
+                if (matches(f, topic)) {
+                    s.second.inbox.push_back({ topic, std::vector<uint8_t>(payload, payload + length) });
+                    break;
+                }
+            }
+        }
+    }
+};
+
+static HostBroker& broker() {
+    static HostBroker b;
+    return b;
+}
+
+PubSubClient::PubSubClient() {
+    setBufferSize(MQTT_MAX_PACKET_SIZE);
+}
+
+PubSubClient::PubSubClient(Client&) : PubSubClient() {
+}
+
+PubSubClient::~PubSubClient() {
+    disconnect();
+    free(buffer_);
+}
+
+PubSubClient& PubSubClient::setServer(const char*, uint16_t) {
+    return *this;
+}
+
+PubSubClient& PubSubClient::setCallback(MQTT_CALLBACK_SIGNATURE) {
+    callback_ = callback;
+    return *this;
+}
+
+bool PubSubClient::setBufferSize(uint16_t size) {
+    if (size == 0) return false;
+    uint8_t* b = (uint8_t*)realloc(buffer_, size);
+    if (!b) return false;
+    buffer_ = b;
+    bufferSize_ = size;
+    return true;
+}
+
+bool PubSubClient::connect(const char* id) {
+    return connect(id, nullptr, nullptr);
+}
+
+bool PubSubClient::connect(const char*, const char*, const char*) {
+    HostBroker& b = broker();
+    std::lock_guard<std::mutex> lk(b.lock);
+    if (!b.online) {
+        state_ = MQTT_CONNECT_FAILED;
+        return false;
+    }
+    b.sessions[this];
+    state_ = MQTT_CONNECTED;
+    return true;
+}
+
+void PubSubClient::disconnect() {
+    HostBroker& b = broker();
+    std::lock_guard<std::mutex> lk(b.lock);
+    b.sessions.erase(this);
+    state_ = MQTT_DISCONNECTED;
+}
+
+bool PubSubClient::connected() {
+    return state_ == MQTT_CONNECTED;
+}
+
+bool PubSubClient::publish(const char* topic, const char* payload) {
+    return publish(topic, (const uint8_t*)payload, payload ? strlen(payload) : 0, false);
+}
+
+bool PubSubClient::publish(const char* topic, const char* payload, bool retained) {
+    return publish(topic, (const uint8_t*)payload, payload ? strlen(payload) : 0, retained);
+}
+
+bool PubSubClient::publish(const char* topic, const uint8_t* payload, unsigned int length) {
+    return publish(topic, payload, length, false);
+}
+
+bool PubSubClient::publish(const char* topic, const uint8_t* payload, unsigned int length, bool) {
+    if (!connected()) return false;
+    // Fixed header + topic length + topic + payload must fit the buffer
+    if (5 + 2 + strlen(topic) + length > bufferSize_) return false;
+    HostBroker& b = broker();
+    std::lock_guard<std::mutex> lk(b.lock);
+    b.published++;
+    b.route(topic, payload, length);
+    return true;
+}
+
+bool PubSubClient::subscribe(const char* topic, uint8_t) {
+    if (!connected()) return false;
+    HostBroker& b = broker();
+    std::lock_guard<std::mutex> lk(b.lock);
+    b.sessions[this].filters.push_back(topic);
+    return true;
+}
+
+bool PubSubClient::unsubscribe(const char* topic) {
+    if (!connected()) return false;
+    HostBroker& b = broker();
+    std::lock_guard<std::mutex> lk(b.lock);
+    auto& filters = b.sessions[this].filters;
+    for (auto it = filters.begin(); it != filters.end(); ++it) {
+        if (*it == topic) {
+            filters.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PubSubClient::loop() {
+    if (!connected()) return false;
+
+    // One message per loop(), like the real client reading one packet
+    HostBroker::Message msg;
+    {
+        HostBroker& b = broker();
+        std::lock_guard<std::mutex> lk(b.lock);
+        auto& inbox = b.sessions[this].inbox;
+        if (inbox.empty()) return true;
+        msg = std::move(inbox.front());
+        inbox.pop_front();
+    }
+
+    // Topic and payload are handed out of the packet buffer, as on device:
+    // the topic is NUL-terminated in place, the payload is not
+    size_t topicLen = msg.topic.size();
+    if (5 + 2 + topicLen + 1 + msg.payload.size() > bufferSize_) return true;  // dropped
+    memcpy(buffer_, msg.topic.c_str(), topicLen + 1);
+    uint8_t* payload = buffer_ + topicLen + 1;
+    if (!msg.payload.empty()) memcpy(payload, msg.payload.data(), msg.payload.size());
+    if (callback_) callback_((char*)buffer_, payload, (unsigned int)msg.payload.size());
+    return true;
+}
+
+void hostBrokerPublish(const char* topic, const uint8_t* payload, unsigned int length) {
+    HostBroker& b = broker();
+    std::lock_guard<std::mutex> lk(b.lock);
+    b.route(topic, payload, length);
+}
+
+void hostBrokerSetOnline(bool online) {
+    HostBroker& b = broker();
+    std::lock_guard<std::mutex> lk(b.lock);
+    b.online = online;
+}
+
+uint32_t hostBrokerPublished() {
+    HostBroker& b = broker();
+    std::lock_guard<std::mutex> lk(b.lock);
+    return b.published;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+// PubSubClient against an in-process broker (host builds).
+//
+// Every client shares one loopback broker: publish() queues the message
+// for each connected client subscribed to the exact topic (or a trailing
+// '#' filter) and loop() delivers queued messages to the callback, the
+// same place the real client dispatches them. hostBrokerPublish() injects
+// messages as if they came from the server.
+
+#include <Arduino.h>
+#include <Client.h>
+#include <functional>
+
+#define MQTT_MAX_PACKET_SIZE 256
+
+#define MQTT_CONNECTION_TIMEOUT     -4
+#define MQTT_CONNECTION_LOST        -3
+#define MQTT_CONNECT_FAILED         -2
+#define MQTT_DISCONNECTED           -1
+#define MQTT_CONNECTED               0
+#define MQTT_CONNECT_UNAVAILABLE     3
+
+// ESP32 builds of PubSubClient use std::function callbacks
+#define MQTT_CALLBACK_SIGNATURE std::function<void(char*, uint8_t*, unsigned int)> callback
+
+class PubSubClient {
+public:
+    PubSubClient();
+    explicit PubSubClient(Client& client);
+    ~PubSubClient();
+
+    PubSubClient& setServer(const char* domain, uint16_t port);
+    PubSubClient& setCallback(MQTT_CALLBACK_SIGNATURE);
+    PubSubClient& setClient(Client&) { return *this; }
+    PubSubClient& setKeepAlive(uint16_t) { return *this; }
+    PubSubClient& setSocketTimeout(uint16_t) { return *this; }
+    bool setBufferSize(uint16_t size);
+    uint16_t getBufferSize() const { return bufferSize_; }
+
+    bool connect(const char* id);
+    bool connect(const char* id, const char* user, const char* pass);
+    void disconnect();
+    bool connected();
+    int state() const { return state_; }
+
+    bool publish(const char* topic, const char* payload);
+    bool publish(const char* topic, const char* payload, bool retained);
+    bool publish(const char* topic, const uint8_t* payload, unsigned int length);
+    bool publish(const char* topic, const uint8_t* payload, unsigned int length, bool retained);
+    bool subscribe(const char* topic, uint8_t qos = 0);
+    bool unsubscribe(const char* topic);
+    bool loop();
+
+private:
+    friend struct HostBroker;
+
+    std::function<void(char*, uint8_t*, unsigned int)> callback_;
+    uint16_t bufferSize_ = MQTT_MAX_PACKET_SIZE;
+    uint8_t* buffer_ = nullptr;
+    int state_ = MQTT_DISCONNECTED;
+};
+
+// Host only
+void hostBrokerPublish(const char* topic, const uint8_t* payload, unsigned int length);
+void hostBrokerSetOnline(bool online);   // offline: connect() fails
+uint32_t hostBrokerPublished();          // messages accepted from clients
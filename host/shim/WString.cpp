@@ -0,0 +1,80 @@
+#include "WString.h"
+#include <ctype.h>
+#include <stdio.h>
+
+bool String::equalsIgnoreCase(const String& o) const {
+    if (s_.size() != o.s_.size()) return false;
+    for (size_t i = 0; i < s_.size(); i++) {
+        if (tolower((unsigned char)s_[i]) != tolower((unsigned char)o.s_[i])) return false;
+    }
+    return true;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) {
+        unsigned int t = from;
+        from = to;
+        to = t;
+    }
+    if (from >= s_.size()) return String();
+    if (to > s_.size()) to = s_.size();
+    return String(s_.substr(from, to - from));
+}
+
+void String::replace(const String& find, const String& with) {
+    if (find.s_.empty()) return;
+    size_t p = 0;
+    while ((p = s_.find(find.s_, p)) != std::string::npos) {
+        s_.replace(p, find.s_.size(), with.s_);
+        p += with.s_.size();
+    }
+}
+
+void String::replace(char find, char with) {
+    for (char& c : s_) {
+        if (c == find) c = with;
+    }
+}
+
+void String::trim() {
+    size_t b = 0;
+    size_t e = s_.size();
+    while (b < e && isspace((unsigned char)s_[b])) b++;
+    while (e > b && isspace((unsigned char)s_[e - 1])) e--;
+    s_ = s_.substr(b, e - b);
+}
+
+void String::toLowerCase() {
+    for (char& c : s_) c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+    for (char& c : s_) c = (char)toupper((unsigned char)c);
+}
+
+void String::fromLong(long v, unsigned char base) {
+    if (v < 0 && base == 10) {
+        fromULong((unsigned long)-v, base);
+        s_.insert(s_.begin(), '-');
+    } else {
+        fromULong((unsigned long)v, base);
+    }
+}
+
+void String::fromULong(unsigned long v, unsigned char base) {
+    char buf[8 * sizeof(long) + 1];
+    char* p = buf + sizeof(buf);
+    *--p = '\0';
+    do {
+        unsigned long d = v % base;
+        *--p = (char)(d < 10 ? '0' + d : 'A' + d - 10);
+        v /= base;
+    } while (v);
+    s_ = p;
+}
+
+void String::fromDouble(double v, unsigned int decimals) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    s_ = buf;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+// Arduino String on top of std::string (host builds).
+//
+// Covers the members the firmware uses, with Arduino semantics: indexes
+// are int, "not found" is -1, and substring() clamps instead of throwing.
+// Allocations go through operator new, so the bench runner counts them.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string>
+
+class String {
+public:
+    String() = default;
+    String(const char* s) : s_(s ? s : "") {}
+    String(const char* s, unsigned int len) : s_(s ? s : "", s ? len : 0) {}
+    String(const std::string& s) : s_(s) {}
+    explicit String(char c) : s_(1, c) {}
+    explicit String(int v, unsigned char base = 10) { fromLong(v, base); }
+    explicit String(unsigned int v, unsigned char base = 10) { fromULong(v, base); }
+    explicit String(long v, unsigned char base = 10) { fromLong(v, base); }
+    explicit String(unsigned long v, unsigned char base = 10) { fromULong(v, base); }
+    explicit String(float v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+    explicit String(double v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+
+    const char* c_str() const { return s_.c_str(); }
+    unsigned int length() const { return (unsigned int)s_.size(); }
+    bool isEmpty() const { return s_.empty(); }
+    bool reserve(unsigned int size) { s_.reserve(size); return true; }
+
+    char operator[](unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+    char& operator[](unsigned int i) { return s_[i]; }
+    char charAt(unsigned int i) const { return (*this)[i]; }
+
+    String& operator=(const char* s) { s_ = s ? s : ""; return *this; }
+    String& operator+=(const String& o) { s_ += o.s_; return *this; }
+    String& operator+=(const char* s) { if (s) s_ += s; return *this; }
+    String& operator+=(char c) { s_ += c; return *this; }
+    String& operator+=(int v) { return *this += String(v); }
+    String& operator+=(unsigned int v) { return *this += String(v); }
+    String& operator+=(long v) { return *this += String(v); }
+    String& operator+=(unsigned long v) { return *this += String(v); }
+    bool concat(const String& o) { s_ += o.s_; return true; }
+    bool concat(const char* s) { if (s) s_ += s; return true; }
+    bool concat(char c) { s_ += c; return true; }
+    bool concat(const char* s, unsigned int len) { s_.append(s, len); return true; }
+
+    bool operator==(const String& o) const { return s_ == o.s_; }
+    bool operator==(const char* s) const { return s_ == (s ? s : ""); }
+    bool operator!=(const String& o) const { return !(*this == o); }
+    bool operator!=(const char* s) const { return !(*this == s); }
+    bool operator<(const String& o) const { return s_ < o.s_; }
+    bool equals(const String& o) const { return *this == o; }
+    bool equalsIgnoreCase(const String& o) const;
+    bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+    bool endsWith(const String& p) const {
+        return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+    }
+
+    int indexOf(char c, unsigned int from = 0) const { return pos(s_.find(c, from)); }
+    int indexOf(const String& n, unsigned int from = 0) const { return pos(s_.find(n.s_, from)); }
+    int indexOf(const char* n, unsigned int from = 0) const { return pos(s_.find(n, from)); }
+    int lastIndexOf(char c) const { return pos(s_.rfind(c)); }
+    int lastIndexOf(const String& n) const { return pos(s_.rfind(n.s_)); }
+
+    String substring(unsigned int from) const { return substring(from, length()); }
+    String substring(unsigned int from, unsigned int to) const;
+
+    void replace(const String& find, const String& with);
+    void replace(char find, char with);
+    void remove(unsigned int index) { if (index < s_.size()) s_.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < s_.size()) s_.erase(index, count); }
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+
+    long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(s_.c_str(), nullptr); }
+
+    const std::string& str() const { return s_; }
+
+private:
+    static int pos(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+    void fromLong(long v, unsigned char base);
+    void fromULong(unsigned long v, unsigned char base);
+    void fromDouble(double v, unsigned int decimals);
+
+    std::string s_;
+};
+
+inline String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+inline String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, char b) { String r(a); r += b; return r; }
+inline bool operator==(const char* a, const String& b) { return b == a; }
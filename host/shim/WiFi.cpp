@@ -0,0 +1,16 @@
+#include <WiFi.h>
+
+WiFiClass WiFi;
+
+wl_status_t WiFiClass::begin(const char* ssid, const char*) {
+    ssid_ = ssid ? ssid : "";
+    if (mode_ == WIFI_OFF) mode_ = WIFI_STA;
+    if (!forced_) status_ = WL_CONNECTED;
+    return status_;
+}
+
+bool WiFiClass::disconnect(bool wifiOff, bool) {
+    if (!forced_) status_ = WL_DISCONNECTED;
+    if (wifiOff) mode_ = WIFI_OFF;
+    return true;
+}
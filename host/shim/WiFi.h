@@ -0,0 +1,91 @@
+#pragma once
+
+// WiFi station stub (host builds).
+//
+// No radio: begin() "associates" immediately unless hostSetStatus() says
+// otherwise, and clients never open sockets. Enough for modules that only
+// consult link state or hand a Client to another library.
+
+#include <Arduino.h>
+
+class IPAddress {
+public:
+    IPAddress() : addr_{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr_{a, b, c, d} {}
+    uint8_t operator[](int i) const { return addr_[i]; }
+    bool operator==(const IPAddress& o) const { return memcmp(addr_, o.addr_, 4) == 0; }
+    bool operator!=(const IPAddress& o) const { return !(*this == o); }
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", addr_[0], addr_[1], addr_[2], addr_[3]);
+        return String(buf);
+    }
+
+private:
+    uint8_t addr_[4];
+};
+
+typedef enum {
+    WL_IDLE_STATUS     = 0,
+    WL_NO_SSID_AVAIL   = 1,
+    WL_SCAN_COMPLETED  = 2,
+    WL_CONNECTED       = 3,
+    WL_CONNECT_FAILED  = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED    = 6
+} wl_status_t;
+
+typedef enum { WIFI_OFF, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+
+class Client : public Print {
+public:
+    virtual int connect(const char* host, uint16_t port) = 0;
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int read(uint8_t* buf, size_t size) = 0;
+    virtual void stop() = 0;
+    virtual uint8_t connected() = 0;
+    virtual void flush() {}
+    virtual operator bool() { return connected(); }
+};
+
+class WiFiClient : public Client {
+public:
+    int connect(const char*, uint16_t) override { return 0; }
+    size_t write(uint8_t) override { return 0; }
+    size_t write(const uint8_t*, size_t) override { return 0; }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int read(uint8_t*, size_t) override { return -1; }
+    void stop() override {}
+    uint8_t connected() override { return 0; }
+    void setTimeout(uint32_t) {}
+};
+
+class WiFiClass {
+public:
+    bool mode(wifi_mode_t m) { mode_ = m; return true; }
+    wifi_mode_t getMode() const { return mode_; }
+    wl_status_t begin(const char* ssid, const char* pass = nullptr);
+    bool disconnect(bool wifiOff = false, bool eraseAp = false);
+    bool setAutoReconnect(bool) { return true; }
+    wl_status_t status() const { return status_; }
+    bool isConnected() const { return status_ == WL_CONNECTED; }
+
+    String SSID() const { return ssid_; }
+    int8_t RSSI() const { return -55; }
+    uint8_t channel() const { return 6; }
+    IPAddress localIP() const { return status_ == WL_CONNECTED ? IPAddress(192, 168, 1, 50) : IPAddress(); }
+    String macAddress() const { return "02:00:00:00:00:01"; }
+
+    // Host only
+    void hostSetStatus(wl_status_t s) { status_ = s; forced_ = true; }
+
+private:
+    wifi_mode_t mode_ = WIFI_OFF;
+    wl_status_t status_ = WL_DISCONNECTED;
+    String ssid_;
+    bool forced_ = false;
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,67 @@
+#include <Wire.h>
+
+TwoWire Wire(0);
+TwoWire Wire1(1);
+
+bool TwoWire::begin(int, int, uint32_t frequency) {
+    if (frequency) frequency_ = frequency;
+    return true;
+}
+
+void TwoWire::attach(uint8_t address, HostI2CDevice* device) {
+    devices_[address & 0x7F] = device;
+}
+
+HostI2CDevice* TwoWire::device(uint8_t address) const {
+    return devices_[address & 0x7F];
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+    txAddress_ = address;
+    txLen_ = 0;
+}
+
+size_t TwoWire::write(uint8_t data) {
+    if (txLen_ >= BUFFER) return 0;
+    tx_[txLen_++] = data;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t len) {
+    size_t n = 0;
+    while (n < len && write(data[n])) n++;
+    return n;
+}
+
+// Return codes follow Arduino-ESP32: 0 ok, 2 address NACK
+uint8_t TwoWire::endTransmission(bool sendStop) {
+    stats_.transactions++;
+    stats_.bytes += 1 + txLen_;
+    if (sendStop) stats_.stops++;
+
+    HostI2CDevice* dev = device(txAddress_);
+    if (!dev) return 2;
+    dev->onWrite(tx_, txLen_);
+    txLen_ = 0;
+    return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t len, uint8_t sendStop) {
+    return (uint8_t)requestFrom((uint16_t)address, (size_t)len, sendStop != 0);
+}
+
+size_t TwoWire::requestFrom(uint16_t address, size_t len, bool sendStop) {
+    stats_.transactions++;
+    stats_.bytes += 1;
+    if (sendStop) stats_.stops++;
+
+    rxPos_ = 0;
+    rxLen_ = 0;
+    HostI2CDevice* dev = device((uint8_t)address);
+    if (!dev) return 0;
+
+    if (len > BUFFER) len = BUFFER;
+    rxLen_ = dev->onRead(rx_, len);
+    stats_.bytes += rxLen_;
+    return rxLen_;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+// Arduino TwoWire on simulated I2C devices (host builds).
+//
+// Attach a HostI2CDevice at an address; transactions addressed to it are
+// routed to its callbacks, anything else NACKs. Counters record what the
+// bus would have carried, so the bench runner can compare access patterns.
+
+#include <Arduino.h>
+
+class HostI2CDevice {
+public:
+    virtual ~HostI2CDevice() = default;
+    // Bytes written in one transaction (register pointer first, usually)
+    virtual void onWrite(const uint8_t* data, size_t len) = 0;
+    // Fill 'len' bytes for a read; return how many the device supplies
+    virtual size_t onRead(uint8_t* data, size_t len) = 0;
+};
+
+class TwoWire {
+public:
+    struct Stats {
+        uint32_t transactions;   // START ... STOP/repeated START
+        uint32_t stops;
+        uint64_t bytes;          // address + data bytes on the wire
+    };
+
+    explicit TwoWire(uint8_t bus) : bus_(bus) {}
+
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+    bool end() { return true; }
+    bool setClock(uint32_t frequency) { frequency_ = frequency; return true; }
+    uint32_t getClock() const { return frequency_; }
+    void setTimeOut(uint16_t) {}
+
+    void beginTransmission(uint8_t address);
+    size_t write(uint8_t data);
+    size_t write(const uint8_t* data, size_t len);
+    uint8_t endTransmission(bool sendStop = true);
+
+    uint8_t requestFrom(uint8_t address, uint8_t len, uint8_t sendStop = true);
+    size_t requestFrom(uint16_t address, size_t len, bool sendStop = true);
+    int available() const { return (int)(rxLen_ - rxPos_); }
+    int read() { return rxPos_ < rxLen_ ? rx_[rxPos_++] : -1; }
+    int peek() const { return rxPos_ < rxLen_ ? rx_[rxPos_] : -1; }
+
+    // Host only
+    void attach(uint8_t address, HostI2CDevice* device);
+    const Stats& stats() const { return stats_; }
+    void resetStats() { stats_ = {}; }
+
+private:
+    static constexpr size_t BUFFER = 128;
+
+    HostI2CDevice* device(uint8_t address) const;
+
+    uint8_t  bus_;
+    uint32_t frequency_ = 100000;
+    HostI2CDevice* devices_[128] = {};
+
+    uint8_t  txAddress_ = 0;
+    uint8_t  tx_[BUFFER];
+    size_t   txLen_ = 0;
+    uint8_t  rx_[BUFFER];
+    size_t   rxLen_ = 0;
+    size_t   rxPos_ = 0;
+    Stats    stats_ = {};
+};
+
+extern TwoWire Wire;
+extern TwoWire Wire1;
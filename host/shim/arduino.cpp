@@ -0,0 +1,94 @@
+#include <Arduino.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <map>
+#include <mutex>
+
+HostSerial Serial;
+
+static const auto boot_time = std::chrono::steady_clock::now();
+static std::atomic<uint64_t> skew_us{0};
+
+static uint64_t uptimeUs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - boot_time).count() + skew_us.load();
+}
+
+unsigned long millis() {
+    return (unsigned long)(uptimeUs() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)uptimeUs();
+}
+
+void hostAdvanceMillis(unsigned long ms) {
+    skew_us.fetch_add((uint64_t)ms * 1000);
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+// --- GPIO ----------------------------------------------------------------------
+
+struct PinIsr {
+    void (*fn)(void*);
+    void* arg;
+};
+
+// Pins are touched from tasks and from the thread standing in for the
+// peripheral, so every access goes through pin_lock
+static std::mutex pin_lock;
+static std::map<uint8_t, uint8_t> pin_levels;
+static std::map<uint8_t, PinIsr> pin_isrs;
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    std::lock_guard<std::mutex> lk(pin_lock);
+    if (mode == INPUT_PULLUP || !pin_levels.count(pin)) pin_levels[pin] = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+    std::lock_guard<std::mutex> lk(pin_lock);
+    pin_levels[pin] = val ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin) {
+    std::lock_guard<std::mutex> lk(pin_lock);
+    auto it = pin_levels.find(pin);
+    return it == pin_levels.end() ? HIGH : it->second;
+}
+
+static void callPlainIsr(void* isr) {
+    reinterpret_cast<void (*)()>(isr)();
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode) {
+    attachInterruptArg(pin, callPlainIsr, reinterpret_cast<void*>(isr), mode);
+}
+
+void attachInterruptArg(uint8_t pin, void (*isr)(void*), void* arg, int) {
+    std::lock_guard<std::mutex> lk(pin_lock);
+    pin_isrs[pin] = { isr, arg };
+}
+
+void detachInterrupt(uint8_t pin) {
+    std::lock_guard<std::mutex> lk(pin_lock);
+    pin_isrs.erase(pin);
+}
+
+void hostRaiseInterrupt(uint8_t pin) {
+    PinIsr isr = {};
+    {
+        std::lock_guard<std::mutex> lk(pin_lock);
+        auto it = pin_isrs.find(pin);
+        if (it == pin_isrs.end()) return;
+        isr = it->second;
+    }
+    isr.fn(isr.arg);
+}
@@ -0,0 +1,337 @@
+#include <Arduino_GFX_Library.h>
+
+Arduino_GFX::Arduino_GFX(int16_t w, int16_t h)
+    : WIDTH(w), HEIGHT(h), _width(w), _height(h) {
+}
+
+void Arduino_GFX::setRotation(uint8_t r) {
+    _rotation = r & 3;
+    if (_rotation & 1) {
+        _width = HEIGHT;
+        _height = WIDTH;
+    } else {
+        _width = WIDTH;
+        _height = HEIGHT;
+    }
+}
+
+void Arduino_GFX::draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) {
+    startWrite();
+    for (int16_t j = 0; j < h; j++) {
+        for (int16_t i = 0; i < w; i++) {
+            writePixel(x + i, y + j, bitmap[(int32_t)j * w + i]);
+        }
+    }
+    endWrite();
+}
+
+// --- Clipped write primitives (caller brackets with startWrite/endWrite) ----
+
+void Arduino_GFX::writePixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+    writePixelPreclipped(x, y, color);
+}
+
+void Arduino_GFX::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    writeFillRect(x, y, 1, h, color);
+}
+
+void Arduino_GFX::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    writeFillRect(x, y, w, 1, color);
+}
+
+void Arduino_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w < 0) { x += w + 1; w = -w; }
+    if (h < 0) { y += h + 1; h = -h; }
+    int16_t x2 = x + w - 1;
+    int16_t y2 = y + h - 1;
+    if (w == 0 || h == 0 || x >= _width || y >= _height || x2 < 0 || y2 < 0) return;
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x2 >= _width) x2 = _width - 1;
+    if (y2 >= _height) y2 = _height - 1;
+    writeFillRectPreclipped(x, y, x2 - x + 1, y2 - y + 1, color);
+}
+
+void Arduino_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+
+    int16_t dx = x1 - x0;
+    int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = (y0 < y1) ? 1 : -1;
+
+    for (; x0 <= x1; x0++) {
+        if (steep) {
+            writePixel(y0, x0, color);
+        } else {
+            writePixel(x0, y0, color);
+        }
+        err -= dy;
+        if (err < 0) {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+}
+
+// --- Transactional primitives ----------------------------------------------
+
+void Arduino_GFX::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    startWrite();
+    writePixel(x, y, color);
+    endWrite();
+}
+
+void Arduino_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    startWrite();
+    writeFastVLine(x, y, h, color);
+    endWrite();
+}
+
+void Arduino_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    startWrite();
+    writeFastHLine(x, y, w, color);
+    endWrite();
+}
+
+void Arduino_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    writeFillRect(x, y, w, h, color);
+    endWrite();
+}
+
+void Arduino_GFX::fillScreen(uint16_t color) {
+    fillRect(0, 0, _width, _height, color);
+}
+
+void Arduino_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    startWrite();
+    if (x0 == x1) {
+        if (y0 > y1) std::swap(y0, y1);
+        writeFastVLine(x0, y0, y1 - y0 + 1, color);
+    } else if (y0 == y1) {
+        if (x0 > x1) std::swap(x0, x1);
+        writeFastHLine(x0, y0, x1 - x0 + 1, color);
+    } else {
+        writeLine(x0, y0, x1, y1, color);
+    }
+    endWrite();
+}
+
+void Arduino_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    startWrite();
+    writeFastHLine(x, y, w, color);
+    writeFastHLine(x, y + h - 1, w, color);
+    writeFastVLine(x, y, h, color);
+    writeFastVLine(x + w - 1, y, h, color);
+    endWrite();
+}
+
+void Arduino_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+
+    startWrite();
+    writePixel(x0, y0 + r, color);
+    writePixel(x0, y0 - r, color);
+    writePixel(x0 + r, y0, color);
+    writePixel(x0 - r, y0, color);
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        writePixel(x0 + x, y0 + y, color);
+        writePixel(x0 - x, y0 + y, color);
+        writePixel(x0 + x, y0 - y, color);
+        writePixel(x0 - x, y0 - y, color);
+        writePixel(x0 + y, y0 + x, color);
+        writePixel(x0 - y, y0 + x, color);
+        writePixel(x0 + y, y0 - x, color);
+        writePixel(x0 - y, y0 - x, color);
+    }
+    endWrite();
+}
+
+void Arduino_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    startWrite();
+    writeFastVLine(x0, y0 - r, 2 * r + 1, color);
+    fillCircleHelper(x0, y0, r, 3, 0, color);
+    endWrite();
+}
+
+void Arduino_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners,
+                                   int16_t delta, uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -r - r;
+    int16_t x = 0;
+    int16_t y = r;
+    int16_t px = x;
+    int16_t py = y;
+
+    delta++;  // Avoid some +1's in the loop
+
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        // These checks avoid double-drawing certain lines
+        if (x < (y + 1)) {
+            if (corners & 1) writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+            if (corners & 2) writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+        }
+        if (y != py) {
+            if (corners & 1) writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+            if (corners & 2) writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+            py = y;
+        }
+        px = x;
+    }
+}
+
+// --- Text --------------------------------------------------------------------
+
+void Arduino_GFX::getTextBounds(const char* str, int16_t x, int16_t y,
+                                int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+    int16_t cx = x, cy = y;
+
+    if (_font) {
+        for (const char* p = str; *p; p++) {
+            uint8_t c = (uint8_t)*p;
+            if (c == '\n') {
+                cx = x;
+                cy += _font->yAdvance;
+                continue;
+            }
+            if (c < _font->first || c > _font->last) continue;
+            const GFXglyph* g = &_font->glyph[c - _font->first];
+            if (g->width && g->height) {
+                int16_t gx1 = cx + g->xOffset;
+                int16_t gy1 = cy + g->yOffset;
+                minx = min<int16_t>(minx, gx1);
+                miny = min<int16_t>(miny, gy1);
+                maxx = max<int16_t>(maxx, gx1 + g->width - 1);
+                maxy = max<int16_t>(maxy, gy1 + g->height - 1);
+            }
+            cx += g->xAdvance;
+        }
+    }
+
+    if (maxx >= minx) {
+        *x1 = minx;
+        *w = maxx - minx + 1;
+    } else {
+        *x1 = x;
+        *w = 0;
+    }
+    if (maxy >= miny) {
+        *y1 = miny;
+        *h = maxy - miny + 1;
+    } else {
+        *y1 = y;
+        *h = 0;
+    }
+}
+
+size_t Arduino_GFX::write(uint8_t c) {
+    if (!_font) return 0;
+    if (c == '\n') {
+        _cursorX = 0;
+        _cursorY += _font->yAdvance;
+        return 1;
+    }
+    if (c < _font->first || c > _font->last) return 1;
+
+    const GFXglyph* g = &_font->glyph[c - _font->first];
+    const uint8_t* bits = _font->bitmap + g->bitmapOffset;
+    uint16_t bit = 0;
+    uint8_t bits8 = 0;
+
+    startWrite();
+    for (uint8_t yy = 0; yy < g->height; yy++) {
+        for (uint8_t xx = 0; xx < g->width; xx++) {
+            if (!(bit++ & 7)) bits8 = *bits++;
+            if (bits8 & 0x80) {
+                writePixel(_cursorX + g->xOffset + xx, _cursorY + g->yOffset + yy, _textColor);
+            }
+            bits8 <<= 1;
+        }
+    }
+    endWrite();
+    _cursorX += g->xAdvance;
+    return 1;
+}
+
+// --- Arduino_Canvas ----------------------------------------------------------
+
+Arduino_Canvas::Arduino_Canvas(int16_t w, int16_t h, Arduino_GFX* output,
+                               int16_t output_x, int16_t output_y, uint8_t rotation)
+    : Arduino_GFX(w, h), _output(output), _output_x(output_x), _output_y(output_y) {
+    (void)rotation;
+}
+
+Arduino_Canvas::~Arduino_Canvas() {
+    free(_framebuffer);
+}
+
+bool Arduino_Canvas::begin(int32_t speed) {
+    if (speed != GFX_SKIP_OUTPUT_BEGIN && _output) {
+        if (!_output->begin(speed)) return false;
+    }
+    if (!_framebuffer) {
+        _framebuffer = (uint16_t*)calloc((size_t)WIDTH * HEIGHT, sizeof(uint16_t));
+    }
+    return _framebuffer != nullptr;
+}
+
+void Arduino_Canvas::writePixelPreclipped(int16_t x, int16_t y, uint16_t color) {
+    _framebuffer[(int32_t)y * WIDTH + x] = color;
+}
+
+void Arduino_Canvas::writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t j = 0; j < h; j++) {
+        uint16_t* row = _framebuffer + (int32_t)(y + j) * WIDTH + x;
+        for (int16_t i = 0; i < w; i++) row[i] = color;
+    }
+}
+
+void Arduino_Canvas::draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) {
+    int16_t x0 = max<int16_t>(x, 0);
+    int16_t y0 = max<int16_t>(y, 0);
+    int16_t x1 = min<int16_t>(x + w, _width);
+    int16_t y1 = min<int16_t>(y + h, _height);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    for (int16_t j = y0; j < y1; j++) {
+        memcpy(_framebuffer + (int32_t)j * WIDTH + x0,
+               bitmap + (int32_t)(j - y) * w + (x0 - x),
+               (size_t)(x1 - x0) * sizeof(uint16_t));
+    }
+}
+
+void Arduino_Canvas::flush() {
+    if (_output) _output->draw16bitRGBBitmap(_output_x, _output_y, _framebuffer, WIDTH, HEIGHT);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+// Host GPIO driver: interrupt enables and wake sources have nothing to
+// drive; the shim's attachInterruptArg() / hostRaiseInterrupt() stand in
+// for the interrupt itself.
+
+#include "esp_err.h"
+
+typedef int gpio_num_t;
+
+typedef enum {
+    GPIO_INTR_DISABLE,
+    GPIO_INTR_POSEDGE,
+    GPIO_INTR_NEGEDGE,
+    GPIO_INTR_ANYEDGE,
+    GPIO_INTR_LOW_LEVEL,
+    GPIO_INTR_HIGH_LEVEL
+} gpio_int_type_t;
+
+inline esp_err_t gpio_intr_enable(gpio_num_t) { return ESP_OK; }
+inline esp_err_t gpio_intr_disable(gpio_num_t) { return ESP_OK; }
+inline esp_err_t gpio_wakeup_enable(gpio_num_t, gpio_int_type_t) { return ESP_OK; }
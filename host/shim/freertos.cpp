@@ -0,0 +1,284 @@
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+struct HostTask {
+    std::thread thread;
+    std::string name;
+    std::atomic<bool> deleted{false};
+
+    // Direct-to-task notification value
+    std::mutex notifyLock;
+    std::condition_variable notified;
+    uint32_t notifyCount = 0;
+};
+
+struct HostQueue {
+    std::mutex lock;
+    std::condition_variable changed;
+    std::deque<std::vector<uint8_t>> items;
+    size_t length;
+    size_t itemSize;
+};
+
+namespace {
+
+// Thrown out of a blocking call once the calling task has been deleted;
+// caught by the task trampoline so the thread unwinds and exits.
+struct TaskDeleted {};
+
+thread_local HostTask* current_task = nullptr;
+
+// Blocked tasks wake this often to notice vTaskDelete()
+constexpr auto DELETE_POLL = std::chrono::milliseconds(10);
+
+const Clock::time_point tick_origin = Clock::now();
+
+void checkDeleted() {
+    if (current_task && current_task->deleted) throw TaskDeleted();
+}
+
+// Waits until pred() holds or 'wait' ticks pass. Returns pred().
+template <typename Pred>
+bool waitFor(HostQueue* q, std::unique_lock<std::mutex>& lk, TickType_t wait, Pred pred) {
+    if (pred()) return true;
+    if (wait == 0) return false;
+
+    bool forever = wait == portMAX_DELAY;
+    auto deadline = Clock::now() + std::chrono::milliseconds(wait);
+    while (!pred()) {
+        auto slice = Clock::now() + DELETE_POLL;
+        if (!forever && deadline < slice) slice = deadline;
+        q->changed.wait_until(lk, slice);
+        if (current_task && current_task->deleted) {
+            lk.unlock();
+            throw TaskDeleted();
+        }
+        if (!forever && Clock::now() >= deadline) return pred();
+    }
+    return true;
+}
+
+BaseType_t send(QueueHandle_t q, const void* item, TickType_t wait, bool front) {
+    checkDeleted();
+    std::unique_lock<std::mutex> lk(q->lock);
+    if (!waitFor(q, lk, wait, [q] { return q->items.size() < q->length; })) return pdFALSE;
+
+    const uint8_t* p = static_cast<const uint8_t*>(item);
+    std::vector<uint8_t> copy(p, p + q->itemSize);
+    if (front) {
+        q->items.push_front(std::move(copy));
+    } else {
+        q->items.push_back(std::move(copy));
+    }
+    q->changed.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t receive(QueueHandle_t q, void* item, TickType_t wait, bool remove) {
+    checkDeleted();
+    std::unique_lock<std::mutex> lk(q->lock);
+    if (!waitFor(q, lk, wait, [q] { return !q->items.empty(); })) return pdFALSE;
+
+    memcpy(item, q->items.front().data(), q->itemSize);
+    if (remove) {
+        q->items.pop_front();
+        q->changed.notify_all();
+    }
+    return pdTRUE;
+}
+
+} // namespace
+
+// --- Queues ------------------------------------------------------------------
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    if (length == 0) return nullptr;
+    HostQueue* q = new HostQueue();
+    q->length = length;
+    q->itemSize = itemSize;
+    return q;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait) {
+    return send(queue, item, wait, false);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void* item, TickType_t wait) {
+    return send(queue, item, wait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t wait) {
+    return send(queue, item, wait, true);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item) {
+    std::lock_guard<std::mutex> lk(queue->lock);
+    const uint8_t* p = static_cast<const uint8_t*>(item);
+    queue->items.clear();
+    queue->items.emplace_back(p, p + queue->itemSize);
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait) {
+    return receive(queue, item, wait, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void* item, TickType_t wait) {
+    return receive(queue, item, wait, false);
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lk(queue->lock);
+    queue->items.clear();
+    queue->changed.notify_all();
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lk(queue->lock);
+    return queue->items.size();
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lk(queue->lock);
+    return queue->length - queue->items.size();
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* woken) {
+    if (woken) *woken = pdFALSE;
+    return send(queue, item, 0, false);
+}
+
+BaseType_t xQueueReceiveFromISR(QueueHandle_t queue, void* item, BaseType_t* woken) {
+    if (woken) *woken = pdFALSE;
+    return receive(queue, item, 0, true);
+}
+
+// --- Tasks -------------------------------------------------------------------
+
+static std::atomic<uint32_t> failing_creates{0};
+
+void hostFailTaskCreates(uint32_t count) {
+    failing_creates = count;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t,
+                                   void* arg, UBaseType_t, TaskHandle_t* handle,
+                                   BaseType_t) {
+    uint32_t failing = failing_creates;
+    while (failing && !failing_creates.compare_exchange_weak(failing, failing - 1)) {}
+    if (failing) return pdFAIL;
+    HostTask* task = new HostTask();
+    task->name = name ? name : "";
+    task->thread = std::thread([task, fn, arg] {
+        current_task = task;
+        try {
+            fn(arg);
+        } catch (const TaskDeleted&) {
+        }
+    });
+    if (handle) *handle = task;
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack,
+                       void* arg, UBaseType_t priority, TaskHandle_t* handle) {
+    return xTaskCreatePinnedToCore(fn, name, stack, arg, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if (!task || task == current_task) {
+        // Self-delete: unwind back to the trampoline. The handle leaks, as
+        // nobody is left to join the thread.
+        if (current_task) {
+            current_task->deleted = true;
+            throw TaskDeleted();
+        }
+        return;
+    }
+    task->deleted = true;
+    if (task->thread.joinable()) task->thread.join();
+    delete task;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    checkDeleted();
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+    checkDeleted();
+}
+
+BaseType_t xTaskDelayUntil(TickType_t* previous, TickType_t period) {
+    TickType_t wake = *previous + period;
+    TickType_t now = xTaskGetTickCount();
+    *previous = wake;
+    if ((int32_t)(wake - now) <= 0) return pdFALSE;
+    vTaskDelay(wake - now);
+    return pdTRUE;
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        Clock::now() - tick_origin).count();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return current_task;
+}
+
+// --- Task notifications ----------------------------------------------------------
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t wait) {
+    HostTask* task = current_task;
+    if (!task) return 0;
+
+    std::unique_lock<std::mutex> lk(task->notifyLock);
+    bool forever = wait == portMAX_DELAY;
+    auto deadline = Clock::now() + std::chrono::milliseconds(forever ? 0 : wait);
+    while (task->notifyCount == 0) {
+        if (!forever && Clock::now() >= deadline) return 0;
+        auto slice = Clock::now() + DELETE_POLL;
+        if (!forever && deadline < slice) slice = deadline;
+        task->notified.wait_until(lk, slice);
+        if (task->deleted) {
+            lk.unlock();
+            throw TaskDeleted();
+        }
+    }
+    uint32_t value = task->notifyCount;
+    task->notifyCount = clearOnExit ? 0 : value - 1;
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (!task) return pdFAIL;
+    {
+        std::lock_guard<std::mutex> lk(task->notifyLock);
+        task->notifyCount++;
+    }
+    task->notified.notify_one();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken) {
+    if (woken) *woken = pdFALSE;
+    xTaskNotifyGive(task);
+}
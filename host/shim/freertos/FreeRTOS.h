@@ -0,0 +1,32 @@
+#pragma once
+
+// FreeRTOS on host threads (env:native).
+//
+// Tasks are std::threads, queues are mutex/condvar ring buffers, one tick
+// is one millisecond. Priorities and core affinity are accepted and
+// ignored. vTaskDelete() on another task takes effect the next time that
+// task blocks in a queue call, and returns once it has exited.
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int32_t  BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef uint32_t TickType_t;
+
+struct HostTask;
+struct HostQueue;
+typedef HostTask*  TaskHandle_t;
+typedef HostQueue* QueueHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdFALSE            0
+#define pdTRUE             1
+#define pdPASS             pdTRUE
+#define pdFAIL             pdFALSE
+#define portMAX_DELAY      ((TickType_t)0xFFFFFFFFu)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+#define tskNO_AFFINITY     0x7FFFFFFF
+
+#define configMAX_PRIORITIES 25
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack,
+                                   void* arg, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t core);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack,
+                       void* arg, UBaseType_t priority, TaskHandle_t* handle);
+void vTaskDelete(TaskHandle_t task);   // nullptr deletes the calling task
+// Host only: the next 'count' task creations fail, to exercise fallbacks
+void hostFailTaskCreates(uint32_t count);
+
+void vTaskDelay(TickType_t ticks);
+BaseType_t xTaskDelayUntil(TickType_t* previous, TickType_t period);
+inline void vTaskDelayUntil(TickType_t* previous, TickType_t period) {
+    xTaskDelayUntil(previous, period);
+}
+TickType_t xTaskGetTickCount();
+TaskHandle_t xTaskGetCurrentTaskHandle();
+
+// Counting-semaphore style notifications only (no eAction variants)
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t wait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken);
+
+#define portYIELD_FROM_ISR(woken) ((void)(woken))
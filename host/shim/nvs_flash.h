@@ -0,0 +1,8 @@
+#pragma once
+
+// NVS partition control; the host store (Preferences.cpp) needs no setup.
+
+#include <esp_err.h>
+
+inline esp_err_t nvs_flash_init() { return ESP_OK; }
+esp_err_t nvs_flash_erase();
@@ -0,0 +1,215 @@
+#include "soft_panel.h"
+
+// Bytes on the bus per address-window command: opcode + 4 parameter bytes
+// for CASET/RASET, opcode only for RAMWR
+static constexpr uint32_t CASET_BYTES = 5;
+static constexpr uint32_t RASET_BYTES = 5;
+static constexpr uint32_t RAMWR_BYTES = 1;
+
+SoftPanel::SoftPanel(int16_t w, int16_t h)
+    : Arduino_GFX(w, h), fb_((size_t)w * h, 0) {
+}
+
+bool SoftPanel::begin(int32_t) {
+    return true;
+}
+
+void SoftPanel::setRotation(uint8_t r) {
+    Arduino_GFX::setRotation(r);
+    // Logical orientation only: the capture is what a viewer would see
+    fb_.assign((size_t)_width * _height, 0);
+    winX_ = winY_ = winW_ = winH_ = -1;
+}
+
+void SoftPanel::resetStats() {
+    stats_ = {};
+}
+
+void SoftPanel::startWrite() {
+    if (writeDepth_++ == 0) stats_.drawCalls++;
+}
+
+void SoftPanel::endWrite() {
+    if (writeDepth_ > 0) writeDepth_--;
+}
+
+void SoftPanel::writeAddrWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    stats_.addrWindows++;
+    if (x != winX_ || w != winW_) {
+        stats_.busBytes += CASET_BYTES;
+        winX_ = x;
+        winW_ = w;
+    }
+    if (y != winY_ || h != winH_) {
+        stats_.busBytes += RASET_BYTES;
+        winY_ = y;
+        winH_ = h;
+    }
+    stats_.busBytes += RAMWR_BYTES;
+}
+
+void SoftPanel::writePixelPreclipped(int16_t x, int16_t y, uint16_t color) {
+    writeAddrWindow(x, y, 1, 1);
+    fb_[(size_t)y * _width + x] = color;
+    stats_.pixels++;
+    stats_.busBytes += 2;
+}
+
+void SoftPanel::writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    writeAddrWindow(x, y, w, h);
+    for (int16_t j = 0; j < h; j++) {
+        uint16_t* row = &fb_[(size_t)(y + j) * _width + x];
+        for (int16_t i = 0; i < w; i++) row[i] = color;
+    }
+    stats_.pixels += (uint64_t)w * h;
+    stats_.busBytes += (uint64_t)w * h * 2;
+}
+
+void SoftPanel::draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) {
+    int16_t x0 = max<int16_t>(x, 0);
+    int16_t y0 = max<int16_t>(y, 0);
+    int16_t x1 = min<int16_t>(x + w, _width);
+    int16_t y1 = min<int16_t>(y + h, _height);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    startWrite();
+    writeAddrWindow(x0, y0, x1 - x0, y1 - y0);
+    for (int16_t j = y0; j < y1; j++) {
+        memcpy(&fb_[(size_t)j * _width + x0], bitmap + (int32_t)(j - y) * w + (x0 - x),
+               (size_t)(x1 - x0) * sizeof(uint16_t));
+    }
+    uint64_t count = (uint64_t)(x1 - x0) * (y1 - y0);
+    stats_.pixels += count;
+    stats_.busBytes += count * 2;
+    endWrite();
+}
+
+// --- Capture -----------------------------------------------------------------
+
+void SoftPanel::toRGB888(std::vector<uint8_t>& out) const {
+    out.resize(fb_.size() * 3);
+    uint8_t* p = out.data();
+    for (uint16_t c : fb_) {
+        // Replicate the high bits so 0x1F/0x3F map to 255
+        uint8_t r = (c >> 11) & 0x1F;
+        uint8_t g = (c >> 5) & 0x3F;
+        uint8_t b = c & 0x1F;
+        *p++ = (r << 3) | (r >> 2);
+        *p++ = (g << 2) | (g >> 4);
+        *p++ = (b << 3) | (b >> 2);
+    }
+}
+
+bool SoftPanel::savePPM(const char* path) const {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    std::vector<uint8_t> rgb;
+    toRGB888(rgb);
+    fprintf(f, "P6\n%d %d\n255\n", _width, _height);
+    bool ok = fwrite(rgb.data(), 1, rgb.size(), f) == rgb.size();
+    return fclose(f) == 0 && ok;
+}
+
+long SoftPanel::diffPPM(const char* path) const {
+    FILE* f = fopen(path, "rb");
+    if (!f) return -1;
+    int w = 0, h = 0, maxval = 0;
+    if (fscanf(f, "P6 %d %d %d", &w, &h, &maxval) != 3 || w != _width || h != _height || maxval != 255) {
+        fclose(f);
+        return -1;
+    }
+    fgetc(f);  // single whitespace after the header
+
+    std::vector<uint8_t> want((size_t)w * h * 3);
+    bool ok = fread(want.data(), 1, want.size(), f) == want.size();
+    fclose(f);
+    if (!ok) return -1;
+
+    std::vector<uint8_t> have;
+    toRGB888(have);
+    long diff = 0;
+    for (size_t i = 0; i < have.size(); i += 3) {
+        if (memcmp(&have[i], &want[i], 3) != 0) diff++;
+    }
+    return diff;
+}
+
+// PNG with stored (uncompressed) deflate blocks: no zlib needed, and the
+// files are only CI artifacts.
+
+static uint32_t crc32(const uint8_t* data, size_t len, uint32_t crc = 0) {
+    static uint32_t table[256];
+    if (!table[1]) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+    }
+    crc = ~crc;
+    while (len--) crc = table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void put32(std::vector<uint8_t>& v, uint32_t x) {
+    v.push_back(x >> 24);
+    v.push_back(x >> 16);
+    v.push_back(x >> 8);
+    v.push_back(x);
+}
+
+static void writeChunk(FILE* f, const char* type, const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> chunk;
+    put32(chunk, data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    put32(chunk, crc32(chunk.data() + 4, chunk.size() - 4));
+    fwrite(chunk.data(), 1, chunk.size(), f);
+}
+
+bool SoftPanel::savePNG(const char* path) const {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+
+    std::vector<uint8_t> rgb;
+    toRGB888(rgb);
+
+    // Scanlines, each prefixed with filter type 0
+    size_t stride = (size_t)_width * 3;
+    std::vector<uint8_t> raw;
+    raw.reserve((stride + 1) * _height);
+    for (int16_t y = 0; y < _height; y++) {
+        raw.push_back(0);
+        raw.insert(raw.end(), rgb.begin() + y * stride, rgb.begin() + (y + 1) * stride);
+    }
+
+    // zlib stream: header, stored blocks of up to 65535 bytes, Adler-32
+    std::vector<uint8_t> z = { 0x78, 0x01 };
+    for (size_t off = 0; off < raw.size(); off += 0xFFFF) {
+        uint16_t len = (uint16_t)min<size_t>(0xFFFF, raw.size() - off);
+        z.push_back(off + len == raw.size() ? 1 : 0);
+        z.push_back(len & 0xFF);
+        z.push_back(len >> 8);
+        z.push_back(~len & 0xFF);
+        z.push_back((~len >> 8) & 0xFF);
+        z.insert(z.end(), raw.begin() + off, raw.begin() + off + len);
+    }
+    uint32_t a = 1, b = 0;
+    for (uint8_t c : raw) {
+        a = (a + c) % 65521;
+        b = (b + a) % 65521;
+    }
+    put32(z, (b << 16) | a);
+
+    std::vector<uint8_t> ihdr;
+    put32(ihdr, _width);
+    put32(ihdr, _height);
+    ihdr.insert(ihdr.end(), { 8, 2, 0, 0, 0 });   // 8-bit RGB, no interlace
+
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    fwrite(signature, 1, sizeof(signature), f);
+    writeChunk(f, "IHDR", ihdr);
+    writeChunk(f, "IDAT", z);
+    writeChunk(f, "IEND", {});
+    return fclose(f) == 0;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+// In-memory stand-in for the ST7789/JD9853 panel.
+//
+// Renders into an RGB565 framebuffer and accounts for what the real driver
+// would have put on the SPI bus: one transaction per outermost
+// startWrite()/endWrite(), an address window per fill/pixel/bitmap (CASET
+// and RASET are skipped when unchanged, as Arduino_TFT does), and two bytes
+// per pixel. Frames can be written out as PPM or PNG, or compared against a
+// previously captured PPM.
+
+#include <Arduino_GFX_Library.h>
+#include <vector>
+
+class SoftPanel : public Arduino_GFX {
+public:
+    struct Stats {
+        uint32_t drawCalls;     // bus transactions (CS asserted)
+        uint32_t addrWindows;   // CASET/RASET/RAMWR sequences
+        uint64_t pixels;        // pixels written
+        uint64_t busBytes;      // command + parameter + pixel bytes
+    };
+
+    SoftPanel(int16_t w, int16_t h);
+
+    bool begin(int32_t speed = GFX_NOT_DEFINED) override;
+    void setRotation(uint8_t r) override;
+    void startWrite() override;
+    void endWrite() override;
+    void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+    void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) override;
+
+    const Stats& stats() const { return stats_; }
+    void resetStats();
+
+    const uint16_t* framebuffer() const { return fb_.data(); }
+    uint16_t pixel(int16_t x, int16_t y) const { return fb_[(size_t)y * _width + x]; }
+
+    bool savePPM(const char* path) const;
+    bool savePNG(const char* path) const;
+    // Pixels that differ from a PPM of the same size, or -1 if it can't be read
+    long diffPPM(const char* path) const;
+
+private:
+    void writeAddrWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+    void toRGB888(std::vector<uint8_t>& out) const;
+
+    std::vector<uint16_t> fb_;
+    Stats stats_ = {};
+    int writeDepth_ = 0;
+    // Last window sent, to skip repeated CASET/RASET like Arduino_TFT
+    int16_t winX_ = -1, winY_ = -1, winW_ = -1, winH_ = -1;
+};
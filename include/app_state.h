@@ -18,6 +18,8 @@ public:
     AppScreen getScreen() const { return current_screen; }
     
     bool shouldRevertToHome() const;
+    // Time left before shouldRevertToHome() turns true (TAPPED only)
+    unsigned long msUntilRevert() const;
     void markTapped();
     
 private:
@@ -1,90 +1,62 @@
-// Auto-generated from Icon.png (40x40)
+// Auto-generated from Icon.png (40x40) by scripts/gen_rle_bitmap.py
+// 3200 bytes raw, 1598 bytes encoded
 #pragma once
-#include <Arduino.h>
+#include "rle_bitmap.h"
 
 #define ICON_WIDTH 40
 #define ICON_HEIGHT 40
 
-const uint16_t icon_bitmap[1600] PROGMEM = {
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xAE1F,
-  0xAE1F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA5FF,0xAE1F,
-  0xB65F,0xA5FF,0x0000,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x4ABF,0x427C,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xAE3F,0xA5DF,
-  0xAE1F,0xA5DF,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x425C,0x425C,0x427E,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA5DF,0xAE3F,
-  0xAE1F,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427C,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x427D,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x63BF,0x63BF,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9E,0x4A9F,
-  0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x63BF,0x63BF,0x63BF,0x639E,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x427D,0x425C,0x427D,
-  0x427C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x63BF,0x63BF,0x639E,0x63BF,0x639E,0x0000,0x0000,0x0000,
-  0x0000,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x427D,0x425C,0x427D,0x427D,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x0000,0x0000,0x0000,0x0000,
-  0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x427D,0x425C,0x427D,0x427D,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x0000,0x0000,0x0000,0x0000,0x427D,
-  0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x427D,0x425C,0x427D,0x427D,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,
-  0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x427D,0x425C,0x427D,0x427D,0x0000,0x0000,0x0000,
-  0x0000,0x427D,0x4A9E,0x425C,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,
-  0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x427D,0x425C,0x427D,0x427D,0x0000,0x0000,0x0000,0x0000,
-  0x427D,0x4A9F,0x427D,0x4ABF,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x639E,0x6BFF,0x639E,0x63BE,0x63BF,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x427C,
-  0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x427D,0x425C,0x427D,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,
-  0x4A9F,0x427C,0x427C,0x4A9F,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x63BF,0x6BFF,0x63BF,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,
-  0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x427D,0x425C,0x427D,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,
-  0x427C,0x425C,0x4A9F,0x425C,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x6BFF,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,
-  0x0000,0x0000,0x0000,0x0000,0x427D,0x427D,0x425C,0x427D,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,
-  0x425C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x427C,0x4A9F,0x425C,0x427C,0x4A9F,0x427D,0x0000,
-  0x0000,0x0000,0x0000,0x427D,0x427D,0x425C,0x427D,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x425C,
-  0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x427D,0x425D,0x427C,0x4A9F,0x427D,0x0000,0x0000,
-  0x0000,0x0000,0x427C,0x429E,0x425C,0x427D,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,
-  0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x427C,0x4ABF,0x4A9F,0x427D,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x425C,0x427D,0x427D,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x427E,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x427E,0x427D,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0xA5FF,0xAE3F,0xA5FF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6BDF,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0xB67F,0xA5DF,0xB67F,0xA5FF,0x0000,0x0000,0x0000,0x0000,0x0000,0x63BF,0x6BDF,0x6BFF,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0xB67F,0xA5FF,0xB69F,0x0000,0x0000,0x0000,0x0000,0x0000,0x63BF,0x63BF,0x5B9E,0x6BDF,
-  0x639E,0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0xA5DF,0xAE5F,0xA5DF,0x0000,0x0000,0x0000,0x0000,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,
-  0x0000,0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x0000,
-  0x0000,0x0000,0x0000,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0xAE5F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x0000,0x0000,
-  0x0000,0x0000,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA5FF,0xB69F,
-  0xAE3F,0xAE3F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x0000,0x0000,0x0000,
-  0x0000,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xA5FF,0xAE3F,
-  0xA5DF,0xB65F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x639E,0x6BFF,0x639E,0x63BF,0x63BF,0x0000,0x0000,0x0000,0x0000,
-  0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xB67F,
-  0xB65F,0xA61F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x63DF,0x6BFF,0x63BF,0x0000,0x0000,0x0000,0x0000,0x427D,
-  0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6BFF,0x0000,0x0000,0x0000,0x0000,0x425C,0x4A9F,
-  0x427C,0x427C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4A9F,0x425C,
-  0x425C,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x427C,0x4ABF,0x425C,
-  0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4A9E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x427D,0x427E,
-  0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4A9F,0x4ABF,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4A9E,0x427D,0x425C,0x4A9F,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x425C,0x4A9F,0x427D,0x425C,0x4A9E,0x427C,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x4A9E,0x427C,0x425C,0x4A9E,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x429E,0x427D,0x4A9F,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x429E,0x427D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-  0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+const uint16_t icon_bitmap_rle[799] PROGMEM = {
+  0x8027,0x0000,0x800E,0x0000,0x0001,0xAE1F,0xAE1F,0x8007,0x0000,0x0000,0x427D,0x800D,0x0000,0x800D,0x0000,0x0003,
+  0xA5FF,0xAE1F,0xB65F,0xA5FF,0x8004,0x0000,0x0003,0x427D,0x4A9F,0x4ABF,0x427C,0x800C,0x0000,0x800D,0x0000,0x0003,
+  0xAE3F,0xA5DF,0xAE1F,0xA5DF,0x8003,0x0000,0x0004,0x427D,0x4A9F,0x425C,0x425C,0x427E,0x800C,0x0000,0x800D,0x0000,
+  0x0002,0xA5DF,0xAE3F,0xAE1F,0x8003,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427C,0x800C,0x0000,0x8013,
+  0x0000,0x0005,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x8003,0x0000,0x0001,0x427D,0x427D,0x8007,0x0000,0x8009,
+  0x0000,0x0001,0x63BF,0x63BF,0x8006,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x8003,0x0000,0x0003,
+  0x427D,0x4A9E,0x4A9F,0x427D,0x8006,0x0000,0x8008,0x0000,0x8002,0x63BF,0x0000,0x639E,0x8004,0x0000,0x0005,0x427D,
+  0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x8003,0x0000,0x0004,0x427D,0x427D,0x425C,0x427D,0x427C,0x8006,0x0000,0x8007,
+  0x0000,0x0004,0x63BF,0x63BF,0x639E,0x63BF,0x639E,0x8003,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,
+  0x8003,0x0000,0x0004,0x427D,0x427D,0x425C,0x427D,0x427D,0x8007,0x0000,0x8006,0x0000,0x0004,0x63BF,0x63BF,0x639E,
+  0x63BE,0x63BF,0x8003,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x8003,0x0000,0x0004,0x427D,0x427D,
+  0x425C,0x427D,0x427D,0x8008,0x0000,0x8005,0x0000,0x0004,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x8003,0x0000,0x0005,
+  0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x8003,0x0000,0x0004,0x427D,0x427D,0x425C,0x427D,0x427D,0x8009,0x0000,
+  0x8004,0x0000,0x0004,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x8003,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,
+  0x427D,0x8003,0x0000,0x0004,0x427D,0x427D,0x425C,0x427D,0x427D,0x8003,0x0000,0x0002,0x427D,0x4A9E,0x425C,0x8003,
+  0x0000,0x8003,0x0000,0x0004,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x8003,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x427C,
+  0x4A9F,0x427D,0x8003,0x0000,0x0004,0x427D,0x427D,0x425C,0x427D,0x427D,0x8003,0x0000,0x0003,0x427D,0x4A9F,0x427D,
+  0x4ABF,0x8003,0x0000,0x8002,0x0000,0x0004,0x639E,0x6BFF,0x639E,0x63BE,0x63BF,0x8003,0x0000,0x0005,0x427D,0x4A9F,
+  0x427C,0x427C,0x4A9F,0x427D,0x8003,0x0000,0x0004,0x427D,0x427D,0x425C,0x427D,0x427D,0x8003,0x0000,0x0004,0x427D,
+  0x4A9F,0x427C,0x427C,0x4A9F,0x8003,0x0000,0x8003,0x0000,0x0002,0x63BF,0x6BFF,0x63BF,0x8003,0x0000,0x0005,0x427D,
+  0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x8003,0x0000,0x0004,0x427D,0x427D,0x425C,0x427D,0x427D,0x8003,0x0000,0x0005,
+  0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x425C,0x8003,0x0000,0x8004,0x0000,0x0000,0x6BFF,0x8003,0x0000,0x0005,0x427D,
+  0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x8003,0x0000,0x0004,0x427D,0x427D,0x425C,0x427D,0x427D,0x8003,0x0000,0x0005,
+  0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x8004,0x0000,0x8008,0x0000,0x0005,0x427C,0x4A9F,0x425C,0x427C,0x4A9F,
+  0x427D,0x8003,0x0000,0x0004,0x427D,0x427D,0x425C,0x427D,0x427D,0x8003,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x425C,
+  0x4A9F,0x427D,0x8005,0x0000,0x8008,0x0000,0x0004,0x427D,0x425D,0x427C,0x4A9F,0x427D,0x8003,0x0000,0x0004,0x427C,
+  0x429E,0x425C,0x427D,0x427D,0x8003,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x8006,0x0000,0x8008,
+  0x0000,0x0003,0x427C,0x4ABF,0x4A9F,0x427D,0x8004,0x0000,0x0000,0x425C,0x8002,0x427D,0x8003,0x0000,0x0005,0x427D,
+  0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x8007,0x0000,0x8009,0x0000,0x0000,0x427E,0x8007,0x0000,0x0001,0x427E,0x427D,
+  0x8003,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x8008,0x0000,0x8017,0x0000,0x0005,0x427D,0x4A9F,
+  0x427C,0x427C,0x4A9F,0x427D,0x8009,0x0000,0x8003,0x0000,0x0002,0xA5FF,0xAE3F,0xA5FF,0x8006,0x0000,0x0000,0x6BDF,
+  0x8007,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x800A,0x0000,0x8003,0x0000,0x0003,0xB67F,0xA5DF,
+  0xB67F,0xA5FF,0x8004,0x0000,0x0002,0x63BF,0x6BDF,0x6BFF,0x8005,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,
+  0x427D,0x800B,0x0000,0x8003,0x0000,0x0002,0xB67F,0xA5FF,0xB69F,0x8004,0x0000,0x0004,0x63BF,0x63BF,0x5B9E,0x6BDF,
+  0x639E,0x8003,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x800C,0x0000,0x8003,0x0000,0x0002,0xA5DF,
+  0xAE5F,0xA5DF,0x8003,0x0000,0x0004,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x8003,0x0000,0x0005,0x427D,0x4A9F,0x427C,
+  0x427C,0x4A9F,0x427D,0x800D,0x0000,0x8009,0x0000,0x0004,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x8003,0x0000,0x0005,
+  0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x8006,0x0000,0x0000,0xAE5F,0x8006,0x0000,0x8008,0x0000,0x0004,0x63BF,
+  0x63BF,0x639E,0x63BE,0x63BF,0x8003,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x8005,0x0000,0x0003,
+  0xA5FF,0xB69F,0xAE3F,0xAE3F,0x8005,0x0000,0x8007,0x0000,0x0004,0x63BF,0x63BF,0x639E,0x63BE,0x63BF,0x8003,0x0000,
+  0x0005,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x8006,0x0000,0x0003,0xA5FF,0xAE3F,0xA5DF,0xB65F,0x8005,0x0000,
+  0x8006,0x0000,0x0004,0x639E,0x6BFF,0x639E,0x63BF,0x63BF,0x8003,0x0000,0x0005,0x427D,0x4A9F,0x427C,0x427C,0x4A9F,
+  0x427D,0x8008,0x0000,0x0002,0xB67F,0xB65F,0xA61F,0x8005,0x0000,0x8007,0x0000,0x0002,0x63DF,0x6BFF,0x63BF,0x8003,
+  0x0000,0x0005,0x427D,0x4A9F,0x427C,0x425C,0x4A9F,0x427D,0x8012,0x0000,0x8008,0x0000,0x0000,0x6BFF,0x8003,0x0000,
+  0x0005,0x425C,0x4A9F,0x427C,0x427C,0x4A9F,0x427D,0x8013,0x0000,0x800D,0x0000,0x0004,0x4A9F,0x425C,0x425C,0x4A9F,
+  0x427D,0x8014,0x0000,0x800C,0x0000,0x0004,0x427C,0x4ABF,0x425C,0x4A9F,0x427D,0x8006,0x0000,0x0000,0x4A9E,0x800D,
+  0x0000,0x800D,0x0000,0x0002,0x427D,0x427E,0x427D,0x8006,0x0000,0x0002,0x4A9F,0x4ABF,0x427D,0x800C,0x0000,0x8016,
+  0x0000,0x0003,0x4A9E,0x427D,0x425C,0x4A9F,0x800C,0x0000,0x8014,0x0000,0x0005,0x425C,0x4A9F,0x427D,0x425C,0x4A9E,
+  0x427C,0x800C,0x0000,0x8014,0x0000,0x0004,0x4A9E,0x427C,0x425C,0x4A9E,0x427D,0x800D,0x0000,0x8014,0x0000,0x0003,
+  0x429E,0x427D,0x4A9F,0x427D,0x800E,0x0000,0x8015,0x0000,0x0001,0x429E,0x427D,0x800F,0x0000,0x8027,0x0000
 };
+
+constexpr RleBitmap icon_bitmap = { ICON_WIDTH, ICON_HEIGHT, icon_bitmap_rle };
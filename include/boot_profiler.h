@@ -0,0 +1,97 @@
+#pragma once
+
+// Where boot time goes, kept across boots.
+//
+// setup() and the modules it drives bracket each phase with begin()/end();
+// a phase that runs more than once in a boot (the internet probe on
+// ethernet, then on WiFi) adds up. commit() closes the boot: the record is
+// appended to a ring of the last HISTORY_LEN boots in NVS, which the portal
+// serves at /api/boot and the MQTT register message summarises. Phases
+// that didn't run (no saved WiFi, ethernet got a lease) are stored as
+// NOT_RUN and left out of the percentiles.
+//
+// Nothing is recorded after commit(), so the same calls can stay in code
+// that also runs later (the portal's connect flow).
+
+#include <Arduino.h>
+#include <atomic>
+#include "json_writer.h"
+
+enum class BootPhase : uint8_t {
+    HOSTED_LINK,      // waiting for the C6 SDIO link
+    C6_CHECK,         // HostedUpdater version / binary check
+    ETH_DHCP,         // ETH.begin() to a lease, or begin() giving up on it
+    WIFI_ASSOC,       // WiFi.begin() to associated (saved credentials)
+    INTERNET_PROBE,   // reachability check, on whichever link came up
+    MQTT_CACHE,       // cached bridge_id lookup
+    READY,            // power-on to the first interactive screen
+    COUNT
+};
+
+class BootProfiler {
+public:
+    static constexpr uint8_t  HISTORY_LEN = 16;
+    static constexpr uint8_t  PHASES      = (uint8_t)BootPhase::COUNT;
+    static constexpr uint16_t NOT_RUN     = 0xFFFF;
+
+    struct Record {
+        uint16_t ms[PHASES];
+    };
+
+    static BootProfiler& instance();
+
+    // Safe from concurrent boot steps, as long as each phase is only
+    // timed from one of them
+    void begin(BootPhase p);
+    void end(BootPhase p);
+
+    // Stamps READY, appends this boot to the history and saves it
+    void commit();
+
+    // History, oldest first (loaded from NVS on first use)
+    uint8_t count();
+    const Record& record(uint8_t i);
+    // Nearest-rank percentile over the history; NOT_RUN if the phase
+    // never ran
+    uint16_t percentile(BootPhase p, uint8_t pct);
+
+    static const char* phaseName(BootPhase p);
+
+    // {"phases":[...],"n":N,"p50":[...],"p95":[...]} plus "boots":[[...],...]
+    // with 'history'; one entry per phase, null where it didn't run
+    void toJson(JsonWriter& w, bool history);
+
+private:
+    BootProfiler();
+    BootProfiler(const BootProfiler&) = delete;
+    BootProfiler& operator=(const BootProfiler&) = delete;
+
+    static constexpr uint8_t STORE_VERSION = 1;
+
+    // As saved in NVS
+    struct Stored {
+        uint8_t version;
+        uint8_t head;       // next slot to write
+        uint8_t count;
+        Record  records[HISTORY_LEN];
+    };
+
+    void load();
+
+    uint32_t start_ms_[PHASES];
+    std::atomic<uint32_t> running_{0};   // bit per phase between begin() and end()
+    bool     committed_ = false;
+    bool     loaded_    = false;
+    Record   current_;
+    Stored   history_;
+};
+
+// Times the enclosing scope as one phase
+class BootPhaseScope {
+public:
+    explicit BootPhaseScope(BootPhase p) : phase_(p) { BootProfiler::instance().begin(p); }
+    ~BootPhaseScope() { BootProfiler::instance().end(phase_); }
+
+private:
+    BootPhase phase_;
+};
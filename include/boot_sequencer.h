@@ -0,0 +1,70 @@
+#pragma once
+
+// Boot steps declared with their dependencies and run concurrently.
+//
+// Each add()ed step gets a short-lived task that waits for the steps named
+// in 'after' and then runs, so independent bring-up (touch reset, FS mount,
+// ethernet negotiation, the C6 link) overlaps instead of queueing. run()
+// starts them all and, until the last one finishes, calls 'tick' on the
+// calling task every TICK_MS with the latest setStatus() text. Steps must
+// not draw; setup() animates the boot screen from the tick instead.
+//
+// Start and end of every step are kept (ms since run()) for report().
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#include <freertos/task.h>
+
+typedef void (*BootStepFn)();
+typedef void (*BootTickFn)(uint32_t elapsed_ms, const char* status);
+
+class BootSequencer {
+public:
+    static constexpr uint8_t  MAX_STEPS     = 16;
+    static constexpr uint32_t TICK_MS       = 40;
+    static constexpr uint32_t DEFAULT_STACK = 4096;
+
+    BootSequencer();
+
+    // Returns the step's bit, to use in a later step's 'after' (0 if full);
+    // 'after' takes bits from earlier add() calls only. 'name' must
+    // outlive the sequencer.
+    uint32_t add(const char* name, BootStepFn fn, uint32_t after = 0,
+                 uint32_t stack = DEFAULT_STACK);
+
+    // Runs every step; returns once all have finished
+    void run(BootTickFn tick = nullptr);
+
+    // From any step
+    void setStatus(const char* status);
+
+    // Per-step start / duration, and the total, to Serial
+    void report() const;
+    uint32_t totalMs() const { return total_ms_; }
+
+private:
+    static constexpr UBaseType_t TASK_PRIORITY = 1;   // same as loop()
+
+    struct Step {
+        const char*    name;
+        BootStepFn     fn;
+        uint32_t       after;
+        uint32_t       stack;
+        uint32_t       start_ms;   // since run()
+        uint32_t       end_ms;
+        BootSequencer* owner;
+        uint8_t        index;
+    };
+
+    static void taskEntry(void* arg);
+
+    Step               steps_[MAX_STEPS];
+    uint8_t            count_    = 0;
+    EventGroupHandle_t done_     = nullptr;
+    uint32_t           begin_ms_ = 0;
+    uint32_t           total_ms_ = 0;
+
+    portMUX_TYPE status_lock_;
+    char         status_[64];
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+// Internet reachability checks that stay cheap when repeated.
+//
+// The real check is an HTTPS GET of api.scorescrape.io/ping expecting
+// "Pong!". The host is resolved once and the address kept for DNS_TTL_MS,
+// and the TLS connection is left open with keep-alive (one per interface),
+// so a repeat probe is one request/response on an established session
+// instead of DNS plus a full handshake. PLAIN_204 is the cheap kind for
+// polling: a plain-HTTP generate_204 request, which also catches captive
+// portals (they answer it with a redirect or a login page).
+//
+// check() blocks. checkAsync() hands the probe to a worker task and calls
+// back from that task when it's done. Probes never overlap: each one pins
+// lwIP's default route to its own interface while it runs and puts the
+// previous default back when it's done, so choosing the route everything
+// else uses is left to the caller (WiFiManager, once a connection wins).
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <WiFiClientSecure.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+enum class ProbeIface : uint8_t { WIFI, ETHERNET, COUNT };
+enum class ProbeKind  : uint8_t { HTTPS_PING, PLAIN_204 };
+
+struct ProbeResult {
+    bool     online;
+    int16_t  status;    // HTTP status; 0 if no response arrived
+    uint16_t ms;
+};
+
+typedef void (*ProbeCallback)(ProbeIface iface, const ProbeResult& result, void* ctx);
+
+class ConnectivityProbe {
+public:
+    static constexpr uint32_t DNS_TTL_MS = 10 * 60 * 1000;
+
+    ConnectivityProbe();
+
+    // Creates the lock and the worker task
+    bool begin();
+
+    ProbeResult check(ProbeIface iface, ProbeKind kind, uint32_t timeout_ms);
+
+    // False if an async probe is still running. 'cb' runs on the worker
+    // task, after busy() has gone false again.
+    bool checkAsync(ProbeIface iface, ProbeKind kind, uint32_t timeout_ms,
+                    ProbeCallback cb, void* ctx);
+    bool busy() const { return async_busy_; }
+
+    // Closes the interface's kept-alive connections (it went down or lost
+    // the boot race); the TLS one holds a few tens of KB
+    void reset(ProbeIface iface);
+
+private:
+    static constexpr UBaseType_t TASK_PRIORITY = 1;
+    static constexpr BaseType_t  TASK_CORE     = 0;   // loop() runs on core 1
+    static constexpr uint32_t    TASK_STACK    = 8192; // TLS handshakes
+    static constexpr uint8_t     IFACES        = (uint8_t)ProbeIface::COUNT;
+
+    struct Host {
+        const char* name;
+        IPAddress   addr;
+        uint32_t    resolved_ms;
+        bool        valid;
+    };
+
+    static void taskEntry(void* arg);
+    void runAsync();
+
+    ProbeResult run(ProbeIface iface, ProbeKind kind, uint32_t timeout_ms);
+    bool resolve(Host& host);
+    // One request on 'client', connecting first if it isn't. Returns the
+    // HTTP status (0 on failure); 'body' gets up to body_len - 1 bytes.
+    int  request(WiFiClient& client, bool tls, Host& host, uint16_t port,
+                 const char* path, char* body, size_t body_len, uint32_t deadline);
+    bool readLine(WiFiClient& client, char* buf, size_t len, uint32_t deadline);
+    // Reads 'len' bytes (-1: until the server closes), appending to body[n]
+    // while there's room; false if they didn't all arrive
+    bool readBody(WiFiClient& client, int32_t len, char* body, size_t body_len,
+                  size_t& n, uint32_t deadline);
+
+    WiFiClientSecure tls_[IFACES];
+    WiFiClient       plain_[IFACES];
+    Host             ping_host_;
+    Host             plain_host_;
+
+    SemaphoreHandle_t lock_ = nullptr;
+    TaskHandle_t      task_ = nullptr;
+
+    // Async request, written by checkAsync() while !async_busy_
+    volatile bool async_busy_ = false;
+    ProbeIface    async_iface_;
+    ProbeKind     async_kind_;
+    uint32_t      async_timeout_ms_ = 0;
+    ProbeCallback async_cb_  = nullptr;
+    void*         async_ctx_ = nullptr;
+};
@@ -10,6 +10,7 @@ public:
     
     bool begin();
     void showBootScreen(const char* status = nullptr);
+    void animateBootScreen(uint32_t elapsed_ms);
     void showHomeScreen();
     void showConnectToNetworkScreen(const char* apSsid);
     void showOnboardingScreen(const char* code);
@@ -26,6 +27,4 @@ private:
     DisplayContext dc;
     
     void applyColorFix();
-
-    Arduino_Canvas* status_canvas_ = nullptr;
 };
@@ -2,6 +2,9 @@
 #define DISPLAY_CONTEXT_H
 
 #include <Arduino_GFX_Library.h>
+#include "flush_engine.h"
+#include "text_metrics.h"
+#include "rle_bitmap.h"
 
 /**
  * DisplayContext - MonkeyC-style drawing API
@@ -35,37 +38,103 @@ public:
         FONT_MONO_SMALL
     };
 
+    // A literal measured at compile time — build with staticText<>() from
+    // font_metrics.h
+    struct StaticText {
+        const char* text;
+        Font font;
+        TextBounds bounds;
+    };
+
     DisplayContext(Arduino_GFX* gfx);
+    ~DisplayContext();
+
+    // Owns the back buffer — not copyable
+    DisplayContext(const DisplayContext&) = delete;
+    DisplayContext& operator=(const DisplayContext&) = delete;
 
     // Core drawing methods (MonkeyC style)
     void clear();
     void setColor(uint16_t foreground, uint16_t background);
     
+    // Text is rasterized as horizontal spans: straight into the back buffer
+    // (transparent background), or, when drawing direct, into a glyph-box
+    // band pre-filled with the background color and pushed a band at a time.
     void drawText(int16_t x, int16_t y, Font font, const char* text, uint8_t justification);
+    void drawText(int16_t x, int16_t y, const StaticText& text, uint8_t justification);
     void fillRectangle(int16_t x, int16_t y, int16_t width, int16_t height);
     void fillCircle(int16_t x, int16_t y, int16_t radius);
     void drawCircle(int16_t x, int16_t y, int16_t radius);
     void drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
     void drawRectangle(int16_t x, int16_t y, int16_t width, int16_t height);
     void drawBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h);
+    // Decodes row by row into the back buffer, or into the panel window a
+    // band at a time when drawing direct; the raw image never exists in RAM.
+    void drawBitmap(int16_t x, int16_t y, const RleBitmap& bitmap);
     
     // Clipping (MonkeyC style)
+    // Clips nest: setClip() pushes the intersection with the current clip,
+    // clearClip() pops back to the enclosing one. Every primitive trims to
+    // the active clip before anything is written. Clips nested deeper than
+    // MAX_CLIP_DEPTH are logged and ignored; their clearClip() still pairs.
     void setClip(int16_t x, int16_t y, int16_t width, int16_t height);
     void clearClip();
     
     // Double buffering (prevents flicker)
+    // When enabled, all primitives draw into a 320x172 RGB565 back buffer
+    // (PSRAM when available) and only the regions touched since the last
+    // swap are pushed to the panel. Falls back to direct drawing if the
+    // buffer can't be allocated.
     void enableDoubleBuffer(bool enable);
     void swapBuffers();  // Call this to display everything at once
+    bool isDoubleBuffered() const { return _isDrawingToBuffer; }
+
+    // swapBuffers() returns once the dirty regions are copied out; the
+    // transfer itself finishes on the flush task. Wait before touching
+    // getGfx() directly, or register a callback (runs on the flush task).
+    void waitForFlush();
+    void onFrameFlushed(FlushDoneCallback cb, void* ctx = nullptr);
     
     // Utility methods
     int16_t getWidth() const;
     int16_t getHeight() const;
     void getTextDimensions(const char* text, Font font, int16_t* width, int16_t* height);
+    // Same bounds drawText() lays runtime strings out with
+    TextBounds getTextBounds(const char* text, Font font);
+
+    // Text bounds are memoized in a small LRU keyed by (font, string hash),
+    // so repeated labels skip the glyph walk. Counters help size the cache.
+    void getTextCacheStats(uint32_t* hits, uint32_t* misses) const;
 
     // Direct GFX access for advanced operations
     Arduino_GFX* getGfx() { return _gfx; }
 
 private:
+    struct Rect {
+        int16_t x, y, w, h;
+    };
+
+    // Dirty regions are merged when they overlap or sit within this many
+    // pixels of each other; a few extra pixels are cheaper than another
+    // address window on the bus.
+    static constexpr uint8_t MAX_DIRTY_RECTS = 8;
+    static constexpr int16_t DIRTY_MERGE_GAP = 4;
+    // Rows per flush tile at full width (narrower regions pack more rows)
+    static constexpr int16_t FLUSH_LINES = 16;
+    static constexpr uint8_t MAX_CLIP_DEPTH = 4;
+    // Pixels per band when pushing text or RLE rows straight to the panel
+    static constexpr int16_t BAND_PIXELS = 2048;
+    static constexpr uint8_t TEXT_CACHE_SIZE = 16;
+
+    // Cached result of a glyph walk
+    struct TextMetrics {
+        const GFXfont* font;
+        uint32_t hash;
+        uint16_t length;
+        TextBounds bounds;
+        uint32_t lastUse;
+    };
+
     Arduino_GFX* _gfx;
     uint16_t _fgColor;
     uint16_t _bgColor;
@@ -73,16 +142,50 @@ private:
     bool _isDrawingToBuffer;
     
     // Buffer for double buffering
+    Arduino_Canvas* _canvas;
     uint16_t* _backBuffer;
+    FlushEngine _flush;
     int16_t _bufferWidth;
     int16_t _bufferHeight;
 
+    Rect _dirty[MAX_DIRTY_RECTS];
+    uint8_t _dirtyCount;
+
+    Rect _clipStack[MAX_CLIP_DEPTH];
+    uint8_t _clipDepth;
+    uint8_t _clipOverflow;   // setClip() calls past MAX_CLIP_DEPTH, not yet cleared
+
+    uint16_t _band[BAND_PIXELS];
+
+    TextMetrics _textCache[TEXT_CACHE_SIZE];
+    uint32_t _textCacheClock;
+    uint32_t _textCacheHits;
+    uint32_t _textCacheMisses;
+
+    // Where primitives land: the back buffer when active, else the panel
+    Arduino_GFX* target() { return _isDrawingToBuffer ? _canvas : _gfx; }
+
     const GFXfont* getFontForSize(Font font);
-    void calculateTextPosition(int16_t x, int16_t y, const char* text, 
-                              const GFXfont* font, uint8_t justification,
-                              int16_t* outX, int16_t* outY);
+    const TextBounds& measureText(const char* text, const GFXfont* font);
+    void calculateTextPosition(int16_t x, int16_t y, const TextBounds& text,
+                              uint8_t justification,
+                              int16_t* outX, int16_t* outY, Rect* outBounds = nullptr);
+    void renderText(int16_t x, int16_t y, const char* text, const GFXfont* font,
+                    const Rect& bounds);
     void initDoubleBuffer();
     void freeDoubleBuffer();
+    void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+    void flushRect(const Rect& r, bool lastInFrame);
+
+    Rect currentClip() const;
+    bool clipToCurrent(Rect& r) const;  // false if nothing is left
+    void fillClipped(int16_t x, int16_t y, int16_t w, int16_t h);
+    void rasterizeText(int16_t x, int16_t y, const char* text, const GFXfont* font,
+                       const Rect& area, uint16_t* dst, int16_t dstX, int16_t dstY,
+                       int32_t stride);
+    void drawLineClipped(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+    void drawCircleClipped(int16_t x0, int16_t y0, int16_t r);
+    void fillCircleClipped(int16_t x0, int16_t y0, int16_t r);
 };
 
-#endif // DISPLAY_CONTEXT_H
\ No newline at end of file
+#endif // DISPLAY_CONTEXT_H
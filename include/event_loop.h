@@ -0,0 +1,48 @@
+#pragma once
+
+// Central wakeup point for loop().
+//
+// Producers on other tasks (the touch task, the network task) post
+// event bits; loop() handles whatever is pending and then blocks in wait()
+// until the next post or the earliest deadline armed with wakeIn(). With
+// nothing pending and no deadline the loop task stays blocked, so the idle
+// task gets the CPU (and can light-sleep, see main.cpp) instead of loop()
+// spinning every 10 ms.
+//
+// Deadlines only last for one wait(): each pass, whatever still needs a
+// poll (the portal's servers, the MQTT socket, screen timers) arms its own.
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+
+enum : EventBits_t {
+    EVENT_TOUCH = 1 << 0,   // new touch samples queued
+    EVENT_NET   = 1 << 1,   // NetService status queued
+    EVENT_TIMER = 1 << 2,   // a wakeIn() deadline passed (never posted)
+};
+
+class EventLoop {
+public:
+    bool begin();
+
+    // Safe from any task
+    void post(EventBits_t bits);
+
+    // Have the next wait() return no later than 'ms' from now; the
+    // earliest of several calls wins
+    void wakeIn(uint32_t ms);
+
+    // Blocks until something is posted or the deadline passes. Returns the
+    // posted bits (cleared), or EVENT_TIMER on a deadline.
+    EventBits_t wait();
+
+private:
+    static constexpr EventBits_t POSTED_EVENTS = EVENT_TOUCH | EVENT_NET;
+    // Without the event group (begin() failed), loop() polls at the old rate
+    static constexpr uint32_t FALLBACK_POLL_MS = 10;
+
+    EventGroupHandle_t group_        = nullptr;
+    bool               has_deadline_ = false;
+    uint32_t           deadline_ms_  = 0;
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+// Pipelined back-buffer -> panel transfer.
+//
+// Two tile buffers in internal, DMA-capable RAM ping-pong between the caller
+// and a dedicated flush task: while the task pushes tile N over the LCD bus,
+// the caller packs tile N+1 out of the back buffer. Tiles are copies, so the
+// back buffer can be drawn into again as soon as the last tile is queued.
+// An optional callback fires on the flush task once a frame has fully landed;
+// it holds a tile while it runs, so it must not call back into the engine.
+
+#include <Arduino_GFX_Library.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+typedef void (*FlushDoneCallback)(void* ctx);
+
+class FlushEngine {
+public:
+    ~FlushEngine() { end(); }
+
+    // Allocates both tiles and starts the flush task. Returns false (and
+    // leaves nothing allocated) if either fails.
+    bool begin(Arduino_GFX* out, size_t tile_pixels);
+    void end();
+    bool isRunning() const { return task_ != nullptr; }
+    size_t tilePixels() const { return tile_pixels_; }
+
+    // Borrow a free tile to pack; blocks while both are in flight.
+    uint16_t* acquireTile();
+    // Hand a packed tile to the flush task. 'last' closes the frame.
+    void submitTile(uint16_t* tile, int16_t x, int16_t y, int16_t w, int16_t h, bool last);
+
+    // Block until every submitted tile is on the panel and the frame-done
+    // callback for it has returned.
+    void waitIdle();
+    void onFrameDone(FlushDoneCallback cb, void* ctx);
+
+private:
+    struct Tile {
+        uint16_t* buf;
+        int16_t x, y, w, h;
+        bool last;
+    };
+
+    static constexpr UBaseType_t TASK_PRIORITY = 3;
+    static constexpr BaseType_t  TASK_CORE     = 0;   // loop() runs on core 1
+    static constexpr uint32_t    TASK_STACK    = 3072;
+
+    static void taskEntry(void* arg);
+    void run();
+
+    Arduino_GFX*  out_         = nullptr;
+    size_t        tile_pixels_ = 0;
+    uint16_t*     tiles_[2]    = { nullptr, nullptr };
+    QueueHandle_t pending_     = nullptr;   // packed tiles for the flush task
+    QueueHandle_t free_        = nullptr;   // tiles ready to be packed
+    TaskHandle_t  task_        = nullptr;
+
+    volatile FlushDoneCallback done_cb_  = nullptr;
+    void* volatile             done_ctx_ = nullptr;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+// Binds DisplayContext's semantic fonts to their generated constexpr glyph
+// tables (see text_metrics.h). Use staticText<FONT_X>("literal") for labels
+// that never change; DisplayContext::drawText() then skips measurement.
+
+#include "display_context.h"
+#include "text_metrics.h"
+
+// Generated by scripts/generate_fonts.sh alongside the GFXfont headers
+#include "../assets/fonts/Inter_Regular_12pt_metrics.h"
+#include "../assets/fonts/Inter_Regular_16pt_metrics.h"
+#include "../assets/fonts/Inter_Semibold_24pt_metrics.h"
+#include "../assets/fonts/Inter_Bold_32pt_metrics.h"
+#include "../assets/fonts/JetBrainsMono_Regular_12pt_metrics.h"
+#include "../assets/fonts/JetBrainsMono_Regular_16pt_metrics.h"
+
+// Must mirror DisplayContext::getFontForSize()
+template <DisplayContext::Font F> struct FontMetricsFor;
+template <> struct FontMetricsFor<DisplayContext::FONT_SMALL>      { using type = Inter_Regular12pt7bMetrics; };
+template <> struct FontMetricsFor<DisplayContext::FONT_MEDIUM>     { using type = Inter_Regular16pt7bMetrics; };
+template <> struct FontMetricsFor<DisplayContext::FONT_LARGE>      { using type = Inter_SemiBold24pt7bMetrics; };
+template <> struct FontMetricsFor<DisplayContext::FONT_XLARGE>     { using type = Inter_Bold32pt7bMetrics; };
+template <> struct FontMetricsFor<DisplayContext::FONT_MONO>       { using type = JetBrainsMono_Regular16pt7bMetrics; };
+template <> struct FontMetricsFor<DisplayContext::FONT_MONO_SMALL> { using type = JetBrainsMono_Regular12pt7bMetrics; };
+
+template <DisplayContext::Font F>
+constexpr DisplayContext::StaticText staticText(const char* text) {
+    return { text, F, measure<typename FontMetricsFor<F>::type>(text) };
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+// Tap / swipe classification from where a touch started and ended.
+//
+// feed() every TouchSample in order; the result is NONE until the sample
+// that lifts the finger, which is classified from the first and last
+// positions and the time between them.
+
+#include <Arduino.h>
+#include "touch_sample.h"
+
+enum class GestureType {
+    NONE,
+    TAP,
+    SWIPE_RIGHT_TO_LEFT,
+    SWIPE_LEFT_TO_RIGHT,
+    SWIPE_TOP_TO_BOTTOM,
+    SWIPE_BOTTOM_TO_TOP
+};
+
+class GestureClassifier {
+public:
+    static const int16_t SWIPE_MIN_DISTANCE = 50;  // Minimum pixels for swipe
+    static const uint32_t SWIPE_MAX_TIME = 500;    // Maximum ms for swipe
+    static const int16_t TAP_MAX_MOVEMENT = 10;    // Maximum movement for tap
+
+    GestureType feed(const TouchSample &s);
+    // Forget any touch in progress
+    void reset() { in_progress_ = false; }
+
+private:
+    bool in_progress_ = false;
+    int16_t start_x_ = 0;
+    int16_t start_y_ = 0;
+    int16_t last_x_ = 0;
+    int16_t last_y_ = 0;
+    uint32_t start_us_ = 0;
+};
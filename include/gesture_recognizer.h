@@ -0,0 +1,104 @@
+#pragma once
+
+// Incremental gesture engine over the touch sample stream.
+//
+// feed() every TouchSample in order; events come out of next() as soon as
+// they are known, so continuous gestures report while the finger is still
+// moving rather than on release:
+//
+//   TAP, DOUBLE_TAP         on release (a DOUBLE_TAP follows its TAP)
+//   LONG_PRESS              while held still, once LONG_PRESS_MS has passed
+//   DRAG_START, DRAG,       from the first sample past TOUCH_SLOP, then per
+//   DRAG_END                moving sample (dx/dy since the last DRAG read)
+//   FLING                   after DRAG_END when the release is fast enough
+//   PINCH_START, PINCH,     two fingers: scale and rotation relative to
+//   PINCH_END               where they landed
+//
+// Time only advances with samples; TouchHandler samples at a fixed rate
+// while a finger is down, which is what drives LONG_PRESS.
+
+#include <Arduino.h>
+#include "touch_sample.h"
+
+enum class GestureEventType : uint8_t {
+    TAP,
+    DOUBLE_TAP,
+    LONG_PRESS,
+    DRAG_START,
+    DRAG,
+    DRAG_END,
+    FLING,
+    PINCH_START,
+    PINCH,
+    PINCH_END
+};
+
+struct GestureEvent {
+    GestureEventType type;
+    uint32_t time_us;
+    int16_t x, y;      // finger position; midpoint of the two for PINCH_*
+    int16_t dx, dy;    // DRAG: since the previous DRAG read; DRAG_START/END: from touch-down
+    float vx, vy;      // FLING: release velocity, px/s
+    float scale;       // PINCH_*: finger spread relative to PINCH_START
+    float rotation;    // PINCH_*: radians since PINCH_START, counter-clockwise positive
+};
+
+class GestureRecognizer {
+public:
+    static constexpr int16_t  TOUCH_SLOP          = 10;      // px before a touch becomes a drag
+    static constexpr uint32_t TAP_MAX_MS          = 300;
+    static constexpr uint32_t LONG_PRESS_MS       = 500;
+    static constexpr uint32_t DOUBLE_TAP_MS       = 300;     // release to release
+    static constexpr int16_t  DOUBLE_TAP_SLOP     = 30;      // px between the two taps
+    static constexpr float    FLING_MIN_VELOCITY  = 400.0f;  // px/s
+    static constexpr uint32_t VELOCITY_WINDOW_MS  = 80;      // samples used for release velocity
+    static constexpr float    PINCH_MIN_SCALE     = 0.02f;   // change that emits a PINCH
+    static constexpr float    PINCH_MIN_ROTATION  = 0.02f;   // radians
+
+    void feed(const TouchSample &s);
+    bool next(GestureEvent &e);
+    void reset();
+
+private:
+    enum class State : uint8_t { IDLE, PRESSED, DRAGGING, PINCHING, SPENT };
+
+    static constexpr uint8_t HISTORY_LEN = 16;
+    static constexpr uint8_t EVENT_LEN   = 8;
+
+    struct HistoryPoint {
+        uint32_t time_us;
+        int16_t x, y;
+    };
+
+    void onDown(const TouchSample &s);
+    void onMove(const TouchSample &s);
+    void onTwoFingers(const TouchSample &s);
+    void onUp(const TouchSample &s);
+    void releaseVelocity(float &vx, float &vy) const;
+    GestureEvent &emit(GestureEventType type, uint32_t time_us, int16_t x, int16_t y);
+    // The newest queued event if it is still unread and of 'type', so
+    // DRAG/PINCH updates merge instead of piling up behind a slow reader
+    GestureEvent *pendingTail(GestureEventType type);
+
+    State state_ = State::IDLE;
+    uint32_t down_us_ = 0;
+    int16_t down_x_ = 0, down_y_ = 0;
+    int16_t last_x_ = 0, last_y_ = 0;       // last sample
+    int16_t drag_x_ = 0, drag_y_ = 0;       // position at the last DRAG
+    bool long_press_sent_ = false;
+
+    // Double tap
+    bool     have_tap_ = false;
+    uint32_t tap_us_ = 0;
+    int16_t  tap_x_ = 0, tap_y_ = 0;
+
+    // Pinch
+    float pinch_span_ = 0, pinch_angle_ = 0;
+    float pinch_scale_ = 1, pinch_rotation_ = 0;   // last emitted
+
+    HistoryPoint history_[HISTORY_LEN];
+    uint8_t history_head_ = 0, history_count_ = 0;
+
+    GestureEvent events_[EVENT_LEN];
+    uint8_t event_head_ = 0, event_count_ = 0;
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+// Reading the small JSON payloads exchanged with the portal page and the
+// MQTT broker.
+//
+// JsonDoc::parse() makes one pass over the text, jsmn-style, recording
+// where each value starts and ends in a fixed token array; nothing is
+// copied and nothing is allocated. Lookups then walk the tokens, not the
+// text, and hand back JsonViews pointing into the original buffer, which
+// must outlive them. Escapes are left in place until a view is copied out
+// with copyTo() (or toString(), the one call that allocates).
+//
+//   JsonDoc doc;
+//   if (doc.parse(payload, length) && doc.get("type").equals("provision")) ...
+
+#include <Arduino.h>
+
+enum class JsonType : uint8_t { NONE, OBJECT, ARRAY, STRING, PRIMITIVE };
+
+struct JsonToken {
+    JsonType type;
+    uint16_t start;     // strings: just past the opening quote
+    uint16_t end;       // one past the last character (strings: the closing quote)
+    uint16_t size;      // objects: members; arrays: elements
+};
+
+struct JsonView {
+    const char* data = nullptr;
+    uint16_t    len  = 0;
+    JsonType    type = JsonType::NONE;
+
+    bool found() const { return type != JsonType::NONE; }
+
+    // Raw comparison, escapes and all; true, false and null compare as
+    // their bare text, so equals("true") also matches the string "true"
+    bool equals(const char* s) const;
+
+    // Unescaped copy, always NUL-terminated and cut (at a character
+    // boundary) to fit 'cap'. Returns the full unescaped length, so a
+    // result >= cap means it was cut.
+    size_t copyTo(char* dst, size_t cap) const;
+    String toString() const;
+};
+
+class JsonDoc {
+public:
+    // The largest payload seen is our own register message echoed back on
+    // the claim topic (36 tokens with the boot timings); a failed parse
+    // drops it, so leave room for it to grow
+    static constexpr uint8_t  MAX_TOKENS = 48;
+    static constexpr uint8_t  MAX_DEPTH  = 8;
+    static constexpr uint16_t MAX_LEN    = 0xFFFF;
+
+    // False if the text isn't one well-formed JSON value, is nested deeper
+    // than MAX_DEPTH or needs more than MAX_TOKENS tokens
+    bool parse(const char* json, size_t len);
+    bool parse(const String& json) { return parse(json.c_str(), json.length()); }
+
+    // Member of the top-level object; found() is false if missing
+    JsonView get(const char* key) const;
+
+    uint8_t tokenCount() const { return count_; }
+    const JsonToken& token(uint8_t i) const { return tokens_[i]; }
+
+private:
+    bool tokenize(const char* json, size_t len);
+    JsonView view(uint8_t i) const;
+
+    const char* json_  = nullptr;
+    uint8_t     count_ = 0;
+    JsonToken   tokens_[MAX_TOKENS];
+};
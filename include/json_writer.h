@@ -0,0 +1,74 @@
+#pragma once
+
+// Streaming JSON output through a fixed buffer.
+//
+// Values go into a BUF_LEN stack buffer that is handed to the sink each
+// time it fills (and on flush()), so a response of any size is written
+// without building it in a String first. Commas and string escaping are
+// handled here; the caller only has to nest begin/end calls properly, up
+// to MAX_DEPTH levels.
+//
+//   JsonWriter w(sink, ctx);
+//   w.beginObject().field("status", "connected").field("ip", ip).endObject();
+//   w.flush();
+
+#include <Arduino.h>
+#include <type_traits>
+
+typedef void (*JsonSinkFn)(const char* data, size_t len, void* ctx);
+
+// Sink that appends to the String passed as 'ctx', for output that has to
+// end up in one piece (an MQTT payload)
+void jsonStringSink(const char* data, size_t len, void* ctx);
+
+class JsonWriter {
+public:
+    static constexpr size_t  BUF_LEN   = 256;
+    static constexpr uint8_t MAX_DEPTH = 16;
+
+    JsonWriter(JsonSinkFn sink, void* ctx) : sink_(sink), ctx_(ctx) {}
+    ~JsonWriter() { flush(); }
+
+    JsonWriter& beginObject();
+    JsonWriter& endObject();
+    JsonWriter& beginArray();
+    JsonWriter& endArray();
+
+    // Inside an object, before each value
+    JsonWriter& key(const char* k);
+
+    JsonWriter& value(const char* s);
+    JsonWriter& value(const String& s) { return value(s.c_str()); }
+    JsonWriter& value(bool b);
+    JsonWriter& null();
+
+    // Any integer type
+    template <typename T, typename std::enable_if<std::is_integral<T>::value &&
+                                                  !std::is_same<T, bool>::value, int>::type = 0>
+    JsonWriter& value(T n) {
+        if (n < 0) return number(0 - (unsigned long long)n, true);
+        return number((unsigned long long)n, false);
+    }
+
+    template <typename T>
+    JsonWriter& field(const char* k, const T& v) { return key(k).value(v); }
+
+    // Hands whatever is buffered to the sink
+    void flush();
+
+private:
+    void separate();
+    void put(char c);
+    void raw(const char* s);
+    void open(char c);
+    void close(char c);
+    JsonWriter& number(unsigned long long magnitude, bool negative);
+
+    JsonSinkFn sink_;
+    void*      ctx_;
+    char       buf_[BUF_LEN];
+    size_t     len_       = 0;
+    uint8_t    depth_     = 0;
+    uint16_t   has_items_ = 0;       // bit per depth: a value was written
+    bool       after_key_ = false;
+};
@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include <PubSubClient.h>
 #include <WiFiClientSecure.h>
+#include <atomic>
 
 #ifndef MQTT_BROKER
 #define MQTT_BROKER "broker.scorescrape.io"
@@ -14,14 +15,32 @@
 #define MQTT_BUFFER_SIZE 512
 #endif
 
-typedef void (*MqttMessageCallback)(const char* topic, const char* payload, unsigned int length);
+#ifndef MQTT_KEEP_SLOTS
+#define MQTT_KEEP_SLOTS 2
+#endif
+
+// 'payload' points straight into PubSubClient's receive buffer: 'length'
+// bytes, not NUL-terminated, and only valid until the callback returns.
+// Callers that need it longer take a copy with MqttClient::keep().
+typedef void (*MqttMessageCallback)(const char* topic, const char* payload,
+                                    unsigned int length, void* ctx);
 
 class MqttClient {
 public:
     MqttClient();
     ~MqttClient() = default;
+    // PubSubClient holds on to tls_, and the dispatch to 'this'
+    MqttClient(const MqttClient&) = delete;
+    MqttClient& operator=(const MqttClient&) = delete;
+
+    // Called from loop() for each message received; nullptr to stop
+    void setCallback(MqttMessageCallback cb, void* ctx);
 
-    void setCallback(MqttMessageCallback cb);
+    // NUL-terminated copy of a payload in one of MQTT_KEEP_SLOTS fixed
+    // slots, for a caller that keeps it past the callback. nullptr if all
+    // slots are taken or it doesn't fit. Give it back with release().
+    char* keep(const char* payload, unsigned int length);
+    void  release(char* kept);
     bool connect(const char* client_id);
     void disconnect();
     void loop();
@@ -32,8 +51,13 @@ public:
     bool publish(const char* topic, const uint8_t* payload, unsigned int length);
 
 private:
-    static void onMessage(char* topic, byte* payload, unsigned int length);
-    MqttMessageCallback callback_ = nullptr;
+    void dispatch(char* topic, uint8_t* payload, unsigned int length);
+
+    MqttMessageCallback callback_     = nullptr;
+    void*               callback_ctx_ = nullptr;
     WiFiClientSecure tls_;
     PubSubClient mqtt_;
+
+    char                 keep_[MQTT_KEEP_SLOTS][MQTT_BUFFER_SIZE];
+    std::atomic<uint8_t> keep_used_{0};   // bit per slot
 };
@@ -18,6 +18,10 @@ public:
     void begin(const char* code);
     void loop();
     void stop();
+    // How long the caller can wait before loop() has work again. Incoming
+    // messages have no wakeup of their own, so while connected this is
+    // the socket poll interval.
+    uint32_t pollDelayMs() const { return poll_delay_ms_; }
 
     MqttProvisionState getState() const { return state_; }
     const char* getError() const { return error_msg_; }
@@ -30,7 +34,9 @@ public:
     static String getBridgeId();
 
 private:
-    static void onMessage(const char* topic, const char* payload, unsigned int length);
+    static constexpr uint32_t POLL_MS = 50;
+
+    static void onMessage(const char* topic, const char* payload, unsigned int length, void* ctx);
     void doConnect();
     void doSubscribe();
     void doPublish();
@@ -43,6 +49,7 @@ private:
     char status_msg_[48] = {0};
     uint32_t last_connect_attempt_ = 0;
     uint32_t connect_interval_ms_ = 5000;
+    uint32_t poll_delay_ms_ = 0;
     bool subscribed_ = false;
     bool published_ = false;
 };
@@ -0,0 +1,80 @@
+#pragma once
+
+// Network work on its own task, off the UI core.
+//
+// The captive portal (DNS + HTTP servers, the pending-connection check and
+// its HTTPS reachability probe, WiFi scans) and MQTT provisioning all block
+// for anything up to several seconds. They run here, pinned to core 0 next
+// to the touch and flush tasks, while loop() on core 1 only draws and reads
+// touch. The two sides talk through a pair of SPSC queues: commands in,
+// status out. Nothing else on WiFiManager or MqttProvision is touched from
+// the UI side once begin() has been called.
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "spsc_queue.h"
+#include "wifi_manager.h"
+#include "mqtt/provision.h"
+
+enum class NetCommandType : uint8_t {
+    START_PROVISIONING      // 'code' is the claim code
+};
+
+struct NetCommand {
+    NetCommandType type;
+    char code[8];
+};
+
+enum class NetStatusType : uint8_t {
+    CONNECTED,              // WiFiManager::isConnected() went true
+    PROVISION_STATUS,       // 'text' is the new onboarding status line
+    PROVISIONED             // bridge_id saved; provisioning has stopped
+};
+
+struct NetStatus {
+    NetStatusType type;
+    char text[48];
+};
+
+typedef void (*NetStatusCallback)(void* ctx);
+
+class NetService {
+public:
+    // Starts the task. Call after wifi.begin(), which still runs inline
+    // during boot.
+    bool begin(WiFiManager& wifi, MqttProvision& provision);
+
+    // UI side. send() is false if the command queue is full.
+    bool send(const NetCommand& cmd);
+    bool poll(NetStatus& status);
+
+    // Called on the network task after each status is queued
+    void onStatus(NetStatusCallback cb, void* ctx);
+
+private:
+    static constexpr UBaseType_t TASK_PRIORITY = 2;
+    static constexpr BaseType_t  TASK_CORE     = 0;   // loop() runs on core 1
+    static constexpr uint32_t    TASK_STACK    = 8192; // TLS handshakes
+    static constexpr size_t      COMMAND_LEN   = 8;
+    static constexpr size_t      STATUS_LEN    = 16;
+
+    static void taskEntry(void* arg);
+    void run();
+    void handleCommand(const NetCommand& cmd);
+    void pushStatus(NetStatusType type, const char* text = "");
+
+    WiFiManager*   wifi_      = nullptr;
+    MqttProvision* provision_ = nullptr;
+    TaskHandle_t   task_      = nullptr;
+
+    SpscQueue<NetCommand, COMMAND_LEN> commands_;
+    SpscQueue<NetStatus, STATUS_LEN>   status_;
+
+    volatile NetStatusCallback status_cb_  = nullptr;
+    void* volatile             status_ctx_ = nullptr;
+
+    // Network task only
+    bool provisioning_    = false;
+    char last_status_[48] = {0};   // last PROVISION_STATUS sent
+};
@@ -26,6 +26,10 @@ public:
     bool    putInt(const char* ns, const char* key, int32_t value);
     bool    getBool(const char* ns, const char* key, bool defaultVal = false);
     bool    putBool(const char* ns, const char* key, bool value);
+    // Raw bytes. getBlob() returns the stored length, or 0 if the key is
+    // missing or doesn't fit in maxLen.
+    size_t  getBlob(const char* ns, const char* key, void* buf, size_t maxLen);
+    bool    putBlob(const char* ns, const char* key, const void* data, size_t len);
 
     // Remove a single key from a namespace
     bool    remove(const char* ns, const char* key);
@@ -0,0 +1,57 @@
+#pragma once
+
+// One-euro filter (Casiez, Roussel, Vogel — CHI 2012).
+//
+// A low-pass filter whose cutoff rises with speed: slow movement is smoothed
+// hard (jitter goes away), fast movement barely at all (no lag). min_cutoff
+// sets the smoothing at rest in Hz, beta how quickly the cutoff opens up
+// with speed, d_cutoff the smoothing of the speed estimate itself. The
+// filtered speed is kept, so callers can extrapolate from it.
+
+#include <math.h>
+
+class OneEuroFilter {
+public:
+    explicit OneEuroFilter(float min_cutoff = 1.0f, float beta = 0.0f, float d_cutoff = 1.0f)
+        : min_cutoff_(min_cutoff), beta_(beta), d_cutoff_(d_cutoff) {}
+
+    void configure(float min_cutoff, float beta, float d_cutoff) {
+        min_cutoff_ = min_cutoff;
+        beta_       = beta;
+        d_cutoff_   = d_cutoff;
+    }
+
+    // Forget history; the next sample passes through unfiltered
+    void reset() { primed_ = false; }
+
+    // Feeds one sample taken dt seconds after the previous one
+    float filter(float x, float dt) {
+        if (!primed_ || dt <= 0.0f) {
+            if (!primed_) dx_ = 0.0f;
+            x_ = x;
+            primed_ = true;
+            return x_;
+        }
+        float dx = (x - x_) / dt;
+        dx_ += alpha(d_cutoff_, dt) * (dx - dx_);
+        float cutoff = min_cutoff_ + beta_ * fabsf(dx_);
+        x_ += alpha(cutoff, dt) * (x - x_);
+        return x_;
+    }
+
+    float value() const { return x_; }
+    float velocity() const { return dx_; }   // units per second
+
+private:
+    static float alpha(float cutoff, float dt) {
+        float tau = 1.0f / (2.0f * (float)M_PI * cutoff);
+        return 1.0f / (1.0f + tau / dt);
+    }
+
+    float min_cutoff_;
+    float beta_;
+    float d_cutoff_;
+    bool  primed_ = false;
+    float x_  = 0.0f;
+    float dx_ = 0.0f;
+};
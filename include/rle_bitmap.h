@@ -0,0 +1,28 @@
+#pragma once
+
+// Run-length encoded RGB565 images.
+//
+// scripts/gen_rle_bitmap.py turns a PNG into a stream of 16-bit words that
+// stays in flash and is expanded a row at a time while drawing, so a mostly
+// empty logo costs a fraction of its raw size and of the flash reads. Each
+// packet starts with a control word:
+//
+//   1ccc cccc cccc cccc   run:     next word repeated c + 1 times
+//   0ccc cccc cccc cccc   literal: next c + 1 words copied as-is
+//
+// Packets never span a row, so rows decode independently of the width of
+// whatever clip they end up drawn through.
+
+#include <Arduino.h>
+
+struct RleBitmap {
+    int16_t width;
+    int16_t height;
+    const uint16_t* data;
+};
+
+// Expands one row starting at 'src', writing only columns [from, from + count)
+// to 'dst' (which receives 'count' pixels). Pass dst == nullptr to skip a row.
+// Returns the start of the next row.
+const uint16_t* rleDecodeRow(const uint16_t* src, int16_t width,
+                             int16_t from, int16_t count, uint16_t* dst);
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <stdint.h>
+
 class DisplayContext;
-class Arduino_GFX;
 
-void drawBootScreen(DisplayContext& dc, Arduino_GFX* gfx, const char* status);
+void drawBootScreen(DisplayContext& dc, const char* status);
+// One frame of the progress animation under the boot screen
+void drawBootProgress(DisplayContext& dc, uint32_t elapsed_ms);
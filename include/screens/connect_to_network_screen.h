@@ -1,6 +1,5 @@
 #pragma once
 
 class DisplayContext;
-class Arduino_GFX;
 
-void drawConnectToNetworkScreen(DisplayContext& dc, Arduino_GFX* gfx, const char* apSsid);
+void drawConnectToNetworkScreen(DisplayContext& dc, const char* apSsid);
@@ -1,6 +1,5 @@
 #pragma once
 
-class DisplayContext;
-class Arduino_GFX;
+#include "display_context.h"
 
-void drawGestureMessage(DisplayContext& dc, Arduino_GFX* gfx, const char* message);
+void drawGestureMessage(DisplayContext& dc, const DisplayContext::StaticText& message);
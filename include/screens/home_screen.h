@@ -1,6 +1,5 @@
 #pragma once
 
 class DisplayContext;
-class Arduino_GFX;
 
-void drawHomeScreen(DisplayContext& dc, Arduino_GFX* gfx);
+void drawHomeScreen(DisplayContext& dc);
@@ -1,10 +1,8 @@
 #pragma once
 
 class DisplayContext;
-class Arduino_GFX;
-class Arduino_Canvas;
 
-void drawOnboardingScreen(DisplayContext& dc, Arduino_GFX* gfx, const char* code);
+void drawOnboardingScreen(DisplayContext& dc, const char* code);
 
-// Updates only the bottom status strip (uses buffered canvas)
-void drawOnboardingStatus(Arduino_Canvas* canvas, const char* msg);
+// Updates only the bottom status strip (clipped, so only the strip is flushed)
+void drawOnboardingStatus(DisplayContext& dc, const char* msg);
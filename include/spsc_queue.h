@@ -0,0 +1,52 @@
+#pragma once
+
+// Fixed-size single-producer / single-consumer ring buffer.
+//
+// Lock-free: the producer only writes head_, the consumer only writes tail_,
+// and each publishes its index with release ordering after touching the
+// slot. Safe between one task and another task, or an ISR and a task, as
+// long as each side stays on its own end. N must be a power of two; one slot
+// is never used, so the queue holds N - 1 items.
+
+#include <atomic>
+#include <stddef.h>
+
+template <typename T, size_t N>
+class SpscQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+    // Producer side. False (and 'item' dropped) when full.
+    bool push(const T& item) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t next = (head + 1) & (N - 1);
+        if (next == tail_.load(std::memory_order_acquire)) return false;
+        slots_[head] = item;
+        head_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. False when empty.
+    bool pop(T& item) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) return false;
+        item = slots_[tail];
+        tail_.store((tail + 1) & (N - 1), std::memory_order_release);
+        return true;
+    }
+
+    // Approximate from either side; exact from the consumer when the
+    // producer is idle
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+    size_t size() const {
+        return (head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire)) & (N - 1);
+    }
+    static constexpr size_t capacity() { return N - 1; }
+
+private:
+    T slots_[N];
+    std::atomic<size_t> head_{0};   // next slot to write
+    std::atomic<size_t> tail_{0};   // next slot to read
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+// Compile-time text measurement for fixed fonts.
+//
+// scripts/generate_fonts.sh emits a <font>_metrics.h next to every font
+// header with the glyph table as constexpr data. measure<Metrics>("literal")
+// folds to the same single-line bounds Arduino_GFX::getTextBounds() reports,
+// so string literals can be laid out with no glyph walking at runtime.
+
+#include <stdint.h>
+
+struct GlyphMetrics {
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t  xOffset;
+    int8_t  yOffset;
+};
+
+// Ink bounds relative to a cursor at (0, 0) on the baseline
+struct TextBounds {
+    int16_t  x1;
+    int16_t  y1;
+    uint16_t w;
+    uint16_t h;
+};
+
+// 'Metrics' is a generated struct with static constexpr first, last and
+// glyphs[] members.
+template <typename Metrics>
+constexpr TextBounds measure(const char* text) {
+    int16_t minX = 0x7FFF, minY = 0x7FFF, maxX = -1, maxY = -1;
+    int16_t cursorX = 0;
+    for (const char* p = text; *p; p++) {
+        uint8_t ch = (uint8_t)*p;
+        if (ch < Metrics::first || ch > Metrics::last) continue;
+
+        const GlyphMetrics& g = Metrics::glyphs[ch - Metrics::first];
+        int16_t gx1 = cursorX + g.xOffset;
+        int16_t gx2 = gx1 + g.width - 1;
+        int16_t gy2 = g.yOffset + g.height - 1;
+        if (gx1 < minX) minX = gx1;
+        if (g.yOffset < minY) minY = g.yOffset;
+        if (gx2 > maxX) maxX = gx2;
+        if (gy2 > maxY) maxY = gy2;
+        cursorX += g.xAdvance;
+    }
+
+    TextBounds b = { 0, 0, 0, 0 };
+    if (maxX >= minX) {
+        b.x1 = minX;
+        b.w  = (uint16_t)(maxX - minX + 1);
+    }
+    if (maxY >= minY) {
+        b.y1 = minY;
+        b.h  = (uint16_t)(maxY - minY + 1);
+    }
+    return b;
+}
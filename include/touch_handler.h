@@ -1,43 +1,138 @@
 #pragma once
 
 #include <Wire.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
 #include "axs5106l.h"
+#include "spsc_queue.h"
+#include "one_euro_filter.h"
+#include "touch_sample.h"
+#include "gesture_classifier.h"
+#include "gesture_recognizer.h"
+#include "touch_recorder.h"
 
-enum class GestureType {
-    NONE,
-    TAP,
-    SWIPE_RIGHT_TO_LEFT,
-    SWIPE_LEFT_TO_RIGHT,
-    SWIPE_TOP_TO_BOTTOM,
-    SWIPE_BOTTOM_TO_TOP
+typedef void (*TouchSampleCallback)(void* ctx);
+
+// Smoothed finger positions for drawing against, in screen coordinates.
+// predicted_* extrapolates the filtered velocity by the prediction lead, to
+// hide the time from sample to pixels on the panel.
+struct TouchMotion {
+    struct Point {
+        float x, y;
+        float vx, vy;                // px/s
+        float predicted_x, predicted_y;
+    };
+    uint32_t time_us;
+    uint8_t  count;                  // 0 once lifted
+    Point    points[AXS5106L_MAX_POINTS];
 };
 
+// Touch input is interrupt driven: TP_INT wakes a task, which then samples
+// the controller at SAMPLE_HZ for as long as a finger is down and sleeps
+// again on the lift. TP_INT is a one-shot low-level interrupt: the ISR
+// turns it off and the task turns it back on once idle, so a line held low
+// doesn't keep firing, and it is already the type a light-sleep GPIO wake
+// needs (enableWakeup()). Raw samples are queued, timestamped, for the UI side
+// to drain from loop(): either through detectGesture() / readGesture(),
+// which share the queue, or raw through readSample(). A one-euro filtered
+// and predicted snapshot is kept alongside for readMotion(). Falls back to
+// polling from loop() if the task can't start.
 class TouchHandler {
 public:
     TouchHandler();
     
     bool begin();
+    // Lets TP_INT wake the chip from light sleep. Leaves its interrupt as
+    // begin() set it up.
+    void enableWakeup();
+    // Latest report consumed from the queue, in screen coordinates
     bool isTouched();
     void getTouchData(TouchData &td);
+    // Classic tap / swipe-on-release classification
     GestureType detectGesture();
+    // Full gesture stream (see gesture_recognizer.h). Both this and
+    // detectGesture() see every sample, so they can be used side by side.
+    bool readGesture(GestureEvent &e);
+
+    // Next queued sample, oldest first. Don't mix with the gesture calls,
+    // which drain the same queue. When polling, the controller is read by
+    // those and discardInput(), once per call.
+    bool readSample(TouchSample &s);
+    // Throws away whatever is queued and any gesture in progress. For
+    // screens that take no touch input, so their touches don't replay as
+    // gestures once the UI is back on one that does.
+    void discardInput();
+    // Samples lost because the UI fell more than a queue's worth behind
+    uint32_t droppedSamples() const { return dropped_samples; }
+
+    // Latest filtered positions; false until the first touch. Safe to call
+    // any time, independent of the sample queue.
+    bool readMotion(TouchMotion &m) const;
+    // How far ahead predicted_* looks; 1-2 sample periods is typical
+    void setPredictionLead(uint32_t ms) { prediction_lead_ms = ms; }
+
+    // Every sample taken off the queue is also written to 'recorder'
+    // (nullptr to stop)
+    void setRecorder(TouchRecorder *r) { recorder = r; }
+
+    // Called on the touch task each time a sample is queued, so the UI side
+    // can block until there is input instead of polling
+    void onSample(TouchSampleCallback cb, void *ctx);
     
 private:
+    static constexpr size_t      QUEUE_LEN     = 32;
+    static constexpr UBaseType_t TASK_PRIORITY = 4;
+    static constexpr BaseType_t  TASK_CORE     = 0;   // loop() runs on core 1
+    static constexpr uint32_t    TASK_STACK    = 3072;
+    // Sampling rate while a finger is down (whole ticks, so 125 Hz in
+    // practice with a 1 ms tick)
+    static constexpr uint32_t    SAMPLE_HZ     = 120;
+    static constexpr TickType_t  SAMPLE_TICKS  = pdMS_TO_TICKS(1000 / SAMPLE_HZ);
+
+    // One-euro tuning for pixel coordinates: ~1.5 Hz smoothing at rest,
+    // opening up quickly on a drag; a fairly responsive velocity estimate
+    // since prediction leans on it
+    static constexpr float FILTER_MIN_CUTOFF = 1.5f;
+    static constexpr float FILTER_BETA       = 0.02f;
+    static constexpr float FILTER_D_CUTOFF   = 4.0f;
+    static constexpr uint32_t DEFAULT_PREDICTION_MS = 16;
+
+    static void onTouchInterrupt(void* arg);   // IRAM_ATTR on the definition
+    static void taskEntry(void* arg);
+    void run();
+    void publish(const TouchData &td, uint32_t time_us);
+    void updateMotion(const TouchSample &s);
+    void pumpSamples();
+    void pollSample();
+
     AXS5106L touch;
     bool last_touch_state;
-    
-    // Gesture detection state
-    bool touch_in_progress;
-    int16_t touch_start_x;
-    int16_t touch_start_y;
-    int16_t touch_last_x;
-    int16_t touch_last_y;
-    uint32_t touch_start_time;
+
+    TaskHandle_t task_handle;
+    volatile uint32_t irq_time_us;
+    volatile uint32_t dropped_samples;
+    uint32_t seen_dropped;         // dropped_samples as of the last pump
+    SpscQueue<TouchSample, QUEUE_LEN> samples;
+    TouchData last_data;   // latest report seen by the UI side
+
+    // Written only by the producer; readers retry while 'motion_seq' is odd
+    // or changes under them (seqlock)
+    OneEuroFilter filters[AXS5106L_MAX_POINTS][2];
+    uint8_t filtered_count;
+    uint32_t last_sample_us;
+    volatile uint32_t prediction_lead_ms;
+    std::atomic<uint32_t> motion_seq;
+    TouchMotion motion;
+
+    GestureClassifier classifier;
+    GestureRecognizer recognizer;
+    GestureType pending_gesture;   // from the classifier, until detectGesture()
+    TouchRecorder *recorder;
+    volatile TouchSampleCallback sample_cb;
+    void * volatile sample_ctx;
     
     // Screen rotation: touch reports in portrait (172x320), display is landscape (320x172)
     // Rotation 1 = 90° CW: touch X becomes screen Y, touch Y becomes screen (320-X)
     void transformCoordinates(int16_t touch_x, int16_t touch_y, int16_t &screen_x, int16_t &screen_y);
-    
-    static const int16_t SWIPE_MIN_DISTANCE = 50;  // Minimum pixels for swipe
-    static const uint32_t SWIPE_MAX_TIME = 500;    // Maximum ms for swipe
-    static const int16_t TAP_MAX_MOVEMENT = 10;    // Maximum movement for tap
 };
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+// Records the touch sample stream as text, for replay on the host
+// (host/replay_touch.cpp).
+//
+// One line per sample, screen coordinates:
+//   @t <time_us> <count> [<x> <y>]...
+// Lines starting with '#' are comments. The replayer reads a
+// "# expect: TAP SWIPE_RIGHT_TO_LEFT ..." line as the gestures the trace
+// should classify to, and a "# events: TAP DOUBLE_TAP ..." line as the
+// GestureRecognizer events it should produce; add them by hand after a
+// capture. Other lines (serial logging mixed into a capture) are ignored.
+
+#include <Arduino.h>
+#include <FS.h>
+#include "touch_sample.h"
+
+class TouchRecorder {
+public:
+    // Stream to 'out', e.g. Serial
+    bool begin(Print &out);
+    // Append to a file, e.g. on LittleFS; flushed on every lift
+    bool begin(fs::FS &fs, const char *path);
+    void end();
+    bool isRecording() const { return out_ != nullptr; }
+
+    void record(const TouchSample &s);
+
+private:
+    Print *out_ = nullptr;
+    fs::File file_;
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "axs5106l.h"
+
+// One report from the controller, points in screen (landscape)
+// coordinates. count == 0 marks the finger lifting.
+struct TouchSample {
+    uint32_t time_us;   // when the report was taken (TP_INT edge or tick)
+    TouchData data;
+};
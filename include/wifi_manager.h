@@ -2,10 +2,10 @@
 
 // Connectivity manager: Ethernet + WiFi (WPA2-Personal & Enterprise) + captive portal.
 //
-// On boot, tries connections in order of reliability:
-//   1. Wired ethernet (IP101GRI over RMII, always-on if cable present)
-//   2. Saved WiFi credentials from NVS
-//   3. SoftAP captive portal for user provisioning
+// On boot, wired ethernet (IP101GRI over RMII) and saved WiFi credentials
+// from NVS are brought up side by side; the first to pass the internet
+// probe is used, ethernet on a tie. If neither does, a SoftAP captive
+// portal takes over for user provisioning.
 //
 // The SoftAP is only torn down after verifying actual internet reachability
 // on whichever interface comes up first. If ethernet gets plugged in while
@@ -15,15 +15,31 @@
 #include <WebServer.h>
 #include <DNSServer.h>
 #include <ETH.h>
+#include "connectivity_probe.h"
+#include "json_writer.h"
 
 enum class ConnType  { NONE, WIFI, ETHERNET };
 enum class WiFiState { IDLE, CONNECTING, CONNECTED, PORTAL_ACTIVE };
 
 class WiFiManager {
 public:
+    // The portal's DNS and HTTP servers have no wakeup of their own, so
+    // handlePortal() still needs calling this often while the portal is up
+    static constexpr uint32_t PORTAL_POLL_MS = 10;
+    // Likewise handleLease() while isRenewingLease()
+    static constexpr uint32_t LEASE_POLL_MS  = 100;
+
+    // Starts the ethernet PHY and DHCP. begin() does this itself, but it
+    // can be called earlier so link negotiation overlaps other boot work.
+    void startEthernet();
     // Optional callback for boot-screen status updates (e.g. "Attempting connection to \"MySSID\"").
     void begin(void (*statusCallback)(const char*) = nullptr);
     void handlePortal();
+    // After a fast connect, hands the interface back to DHCP once boot is
+    // over (see FastConnect). Network task; cheap when there's nothing to do.
+    void handleLease();
+    // DHCP is getting the address back; connections made now would be cut
+    bool isRenewingLease() const { return lease_ == Lease::RENEWING; }
 
     WiFiState getState()  const { return state_; }
     ConnType  connType()  const { return conn_type_; }
@@ -61,6 +77,38 @@ private:
     String   pending_error_;
     uint32_t portal_stop_at_     = 0;
 
+    // Cached scan results for /api/scan. While the portal is up a scan runs
+    // in the background every SCAN_INTERVAL_MS; a request finding the cache
+    // older than SCAN_STALE_MS (SCAN_REFRESH_MS for ?refresh, the Rescan
+    // button) starts one early but still gets the cached list at once.
+    static constexpr uint32_t SCAN_INTERVAL_MS = 60000;
+    static constexpr uint32_t SCAN_STALE_MS    = 30000;
+    static constexpr uint32_t SCAN_REFRESH_MS  = 5000;
+    struct ScanEntry {
+        char    ssid[33];
+        int8_t  rssi;
+        uint8_t channel;
+        bool    open;
+        bool    enterprise;
+    };
+    static constexpr uint8_t SCAN_MAX = 40;
+    ScanEntry scan_[SCAN_MAX];
+    uint8_t   scan_count_   = 0;
+    uint32_t  scan_ms_      = 0;    // when scan_ was taken, 0 = never
+    uint32_t  next_scan_at_ = 0;
+    bool      scanning_     = false;
+
+    // How long begin() waits on ethernet (from startEthernet()) once WiFi
+    // is out of the running: for the link to come up, and then for DHCP
+    static constexpr uint32_t ETH_SETTLE_MS = 2000;
+    static constexpr uint32_t ETH_DHCP_MS   = 6000;
+    static constexpr uint32_t RACE_POLL_MS  = 50;
+    // Keep a saved WiFi association up when ethernet wins the boot race,
+    // instead of disconnecting to save airtime on the C6
+    static constexpr bool KEEP_STANDBY_WIFI = false;
+    uint32_t eth_started_ms_ = 0;
+    bool     eth_started_    = false;
+
     // Set from the ethernet event callback (runs on a different FreeRTOS task)
     static volatile bool eth_link_up_;
     static volatile bool eth_got_ip_;
@@ -69,14 +117,68 @@ private:
     void saveCredentials(const String& ssid, const String& pass,
                          const String& user, bool enterprise);
 
-    // Return empty String on success, or a user-facing error message on failure.
-    // These are blocking — used only during boot with saved credentials.
-    String connectWPA(const String& ssid, const String& pass, uint32_t timeout_ms = 15000);
-    String connectEnterprise(const String& ssid, const String& user,
-                             const String& pass, uint32_t timeout_ms = 20000);
+    // Where the saved network was last joined, so the next attempt can skip
+    // the all-channel scan and DHCP: associate directly with that AP on its
+    // channel and reuse the lease as a static config. A fast attempt that
+    // doesn't associate within FAST_ASSOC_MS, or associates but fails the
+    // probe, is retried cold and the cache dropped. begin() returns on the
+    // static config; handleLease() then hands the interface back to DHCP
+    // from the network task, so the router has a binding for the rest of
+    // the uptime. If DHCP doesn't answer within LEASE_RENEW_MS the cached
+    // config goes back on.
+    struct FastConnect {
+        uint8_t  version;
+        uint8_t  channel;
+        uint8_t  bssid[6];
+        char     ssid[33];
+        uint32_t ip, gateway, mask, dns1, dns2;
+    };
+    static constexpr uint8_t  FAST_VERSION   = 2;
+    static constexpr uint32_t FAST_ASSOC_MS  = 3000;
+    static constexpr uint32_t LEASE_RENEW_MS = 5000;
+    FastConnect fast_ {};
+    bool        fast_valid_  = false;   // fast_ matches saved_ssid_
+    bool        fast_active_ = false;   // current attempt is the directed one
+    bool        static_ip_   = false;   // STA has a static config applied
+
+    // CACHED: connected on fast_'s static config, DHCP not started yet
+    enum class Lease : uint8_t { DHCP, CACHED, RENEWING };
+    Lease    lease_          = Lease::DHCP;
+    uint32_t lease_start_ms_ = 0;
+
+    void loadFastConnect();
+    void saveFastConnect();
+    void clearFastConnect();
+    void applyFastConfig();
+    // WiFi.begin() for 'ssid' (no passphrase when null or empty): directed
+    // with the cached lease when 'fast' and the cache is for this network,
+    // otherwise a full scan with DHCP
+    void beginStation(const String& ssid, const char* pass, bool fast);
+
+    // Start associating with saved credentials and return straight away;
+    // raceConnections() watches the result. Empty String, or a user-facing
+    // error if the attempt couldn't even start.
+    String startWPA(const String& ssid, const String& pass);
+    String startEnterprise(const String& ssid, const String& user, const String& pass);
+    void dropWiFi();
+    // Boot: first of ethernet / saved WiFi to pass the internet probe,
+    // NONE if neither does
+    ConnType raceConnections(bool wifi, uint32_t wifi_timeout_ms);
     bool checkInternet();
     bool checkEthernetInternet();
 
+    ConnectivityProbe probe_;
+
+    // Portal-time ethernet check (handlePortal(), net task): a background
+    // PLAIN_204 probe, then PING to confirm. The result comes back from
+    // the probe task through eth_probe_result_.
+    enum class EthProbe : uint8_t { IDLE, PLAIN, PING };
+    enum : uint8_t { PROBE_PENDING, PROBE_ONLINE, PROBE_OFFLINE };
+    EthProbe         eth_probe_        = EthProbe::IDLE;
+    volatile uint8_t eth_probe_result_ = PROBE_PENDING;
+    uint32_t         next_eth_poll_    = 0;
+    static void onEthProbe(ProbeIface iface, const ProbeResult& result, void* ctx);
+
     void initEthernet();
     static void ethEventHandler(arduino_event_id_t event);
 
@@ -84,13 +186,16 @@ private:
     void stopPortal();
     void hideAP();
     void checkPendingConnection();
+    void startScan();
+    void pollScan();
 
+    void beginJsonResponse();
+    void endJsonResponse(JsonWriter& w);
     void serveRoot();
     void serveFile(const char* path, const char* mime);
     void serveScan();
     void serveConnect();
     void serveStatus();
+    void serveBoot();
     void serveRedirect();
-
-    static String extractJsonValue(const String& json, const char* key);
 };
@@ -1,10 +1,14 @@
 #include "axs5106l.h"
 
-static constexpr uint8_t REG_ID    = 0x08;
-static constexpr uint8_t REG_TOUCH = 0x01;
+static constexpr uint8_t REG_ID     = 0x08;
+static constexpr uint8_t REG_TOUCH  = 0x01;   // gesture, point count
+static constexpr uint8_t REG_POINTS = 0x03;   // 6 bytes per point
+
+static constexpr uint8_t REPORT_LEN = 14;
+static constexpr uint8_t POINT_LEN  = 6;
 
 AXS5106L::AXS5106L(TwoWire &wire, int8_t rst_pin, int8_t int_pin)
-    : _wire(wire), _rst_pin(rst_pin), _int_pin(int_pin) {}
+    : _wire(wire), _rst_pin(rst_pin), _int_pin(int_pin), _mode(ReadMode::REPEATED_START) {}
 
 bool AXS5106L::begin() {
     pinMode(_rst_pin, OUTPUT);
@@ -18,25 +22,41 @@ bool AXS5106L::begin() {
     digitalWrite(_rst_pin, HIGH);
     delay(300);
 
-    // Verify communication
+    // Verify communication, and that the combined transfer works
     uint8_t id[3] = {0};
+    if (_mode == ReadMode::REPEATED_START && i2cRead(REG_ID, id, sizeof(id))) {
+        return true;
+    }
+    _mode = ReadMode::SPLIT;
     return i2cRead(REG_ID, id, sizeof(id));
 }
 
 bool AXS5106L::read(TouchData &data) {
-    uint8_t buf[14] = {0};
-    if (!i2cRead(REG_TOUCH, buf, sizeof(buf))) {
-        return false;
+    uint8_t buf[REPORT_LEN] = {0};
+
+    if (_mode == ReadMode::SPLIT) {
+        if (!i2cRead(REG_TOUCH, buf, REPORT_LEN)) {
+            return false;
+        }
+    } else {
+        // Header first; the point bytes only for the points reported
+        if (!i2cRead(REG_TOUCH, buf, 2)) {
+            return false;
+        }
+        if (buf[1] > 0 && buf[1] <= AXS5106L_MAX_POINTS &&
+            !i2cRead(REG_POINTS, buf + 2, buf[1] * POINT_LEN)) {
+            return false;
+        }
     }
 
     data.count = buf[1];
-    if (data.count == 0 || data.count > AXS5106L_MAX_POINTS) {
+    if (data.count > AXS5106L_MAX_POINTS) {
         data.count = 0;
         return false;
     }
 
     for (uint8_t i = 0; i < data.count; i++) {
-        uint8_t off = 2 + (i * 6);
+        uint8_t off = 2 + (i * POINT_LEN);
         data.points[i].x = ((uint16_t)(buf[off]     & 0x0F) << 8) | buf[off + 1];
         data.points[i].y = ((uint16_t)(buf[off + 2] & 0x0F) << 8) | buf[off + 3];
     }
@@ -44,15 +64,20 @@ bool AXS5106L::read(TouchData &data) {
 }
 
 bool AXS5106L::i2cRead(uint8_t reg, uint8_t *buf, uint8_t len) {
-    // Separate write and read transactions for ESP32-P4 compatibility
     _wire.beginTransmission(AXS5106L_I2C_ADDR);
     _wire.write(reg);
-    if (_wire.endTransmission(true) != 0) {  // true = send stop bit
-        return false;
+    if (_mode == ReadMode::REPEATED_START) {
+        if (_wire.endTransmission(false) != 0) {  // false = repeated start
+            return false;
+        }
+    } else {
+        // Separate write and read transactions for ESP32-P4 compatibility
+        if (_wire.endTransmission(true) != 0) {  // true = send stop bit
+            return false;
+        }
+        delay(1);  // Small delay between transactions
     }
     
-    delay(1);  // Small delay between transactions
-    
     uint8_t received = _wire.requestFrom((uint8_t)AXS5106L_I2C_ADDR, len, (uint8_t)true);
     if (received != len) {
         return false;
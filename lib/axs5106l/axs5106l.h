@@ -18,15 +18,32 @@ struct TouchData {
 
 class AXS5106L {
 public:
+    // How a register read is put on the bus
+    enum class ReadMode : uint8_t {
+        // Register write, repeated START, read. Reports are read as the
+        // 2-byte header, then only count * 6 point bytes.
+        REPEATED_START,
+        // Register write with STOP, 1 ms pause, separate read of the whole
+        // 14-byte report. For boards where the combined transfer fails.
+        SPLIT
+    };
+
     AXS5106L(TwoWire &wire, int8_t rst_pin, int8_t int_pin = -1);
 
+    // Falls back to SPLIT if the chip ID can't be read with a repeated START
     bool begin();
+    // False if the report couldn't be read (bus error, or a point count
+    // out of range); a finger-up report is a success with count 0
     bool read(TouchData &data);
 
+    void setReadMode(ReadMode mode) { _mode = mode; }
+    ReadMode readMode() const { return _mode; }
+
 private:
     TwoWire &_wire;
     int8_t   _rst_pin;
     int8_t   _int_pin;
+    ReadMode _mode;
 
     bool i2cRead(uint8_t reg, uint8_t *buf, uint8_t len);
 };
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+"""Emit constexpr glyph metrics for fontconvert-generated GFXfont headers.
+
+For each Foo_12pt.h given on the command line, writes Foo_12pt_metrics.h
+next to it with a struct <FontName>Metrics holding first/last and the glyph
+table as constexpr data, for use with measure<>() in include/text_metrics.h.
+"""
+
+import os
+import re
+import sys
+
+FONT_RE  = re.compile(r"const\s+GFXfont\s+(\w+)\s+PROGMEM\s*=\s*\{[^}]*?"
+                      r"(0x[0-9A-Fa-f]+|\d+)\s*,\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*(\d+)\s*\}", re.S)
+GLYPHS_RE = re.compile(r"const\s+GFXglyph\s+\w+\[\]\s+PROGMEM\s*=(.*?)const\s+GFXfont", re.S)
+GLYPH_RE  = re.compile(r"\{\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,\s*(-?\d+)\s*,\s*(-?\d+)\s*\}"
+                       r"[^/\n]*(//.*)?")
+
+
+def convert(path):
+    with open(path) as f:
+        src = f.read()
+
+    font = FONT_RE.search(src)
+    glyphs = GLYPHS_RE.search(src)
+    if not font or not glyphs:
+        sys.exit(f"{path}: not a fontconvert GFXfont header")
+
+    name = font.group(1)
+    first = int(font.group(2), 0)
+    last = int(font.group(3), 0)
+    rows = [m.groups() for m in map(GLYPH_RE.search, glyphs.group(1).splitlines()) if m]
+    if len(rows) != last - first + 1:
+        sys.exit(f"{path}: expected {last - first + 1} glyphs, found {len(rows)}")
+
+    base = os.path.splitext(os.path.basename(path))[0]
+    out_path = os.path.join(os.path.dirname(path), base + "_metrics.h")
+    with open(out_path, "w") as out:
+        out.write(f"// Auto-generated from {os.path.basename(path)} by scripts/gen_font_metrics.py\n")
+        out.write("#pragma once\n")
+        out.write('#include "../../include/text_metrics.h"\n\n')
+        out.write(f"struct {name}Metrics {{\n")
+        out.write(f"    static constexpr uint8_t first = 0x{first:02X};\n")
+        out.write(f"    static constexpr uint8_t last  = 0x{last:02X};\n")
+        out.write("    static constexpr GlyphMetrics glyphs[] = {\n")
+        for i, (_, w, h, xa, xo, yo, comment) in enumerate(rows):
+            sep = "," if i < len(rows) - 1 else " "
+            note = f"  {comment.strip()}" if comment else ""
+            out.write(f"        {{ {w:>3}, {h:>3}, {xa:>3}, {xo:>3}, {yo:>4} }}{sep}{note}".rstrip() + "\n")
+        out.write("    };\n")
+        out.write("};\n")
+    print(f"   {out_path}")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.exit("usage: gen_font_metrics.py <font.h>...")
+    for p in sys.argv[1:]:
+        convert(p)
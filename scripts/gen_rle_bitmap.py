@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Encode an RGB565 image as a run-length stream for DisplayContext.
+
+Usage:
+    gen_rle_bitmap.py <input.png | raw_bitmap.h> <output.h> <name> [PREFIX]
+
+Reads a PNG (needs Pillow) or an existing raw `const uint16_t x[] = {...}`
+header with matching WIDTH/HEIGHT defines, and writes a header declaring
+`<name>` as an RleBitmap plus <PREFIX>_WIDTH / <PREFIX>_HEIGHT. The stream
+format is documented in include/rle_bitmap.h.
+"""
+
+import os
+import re
+import sys
+
+MAX_COUNT = 0x8000        # 15-bit count field, stored as count - 1
+MIN_RUN = 3               # shorter repeats are cheaper as literals
+RUN_FLAG = 0x8000
+
+
+def load_png(path):
+    from PIL import Image
+    img = Image.open(path).convert("RGB")
+    w, h = img.size
+    pixels = []
+    for r, g, b in img.getdata():
+        pixels.append(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+    return w, h, pixels, os.path.basename(path)
+
+
+def load_raw_header(path):
+    with open(path) as f:
+        src = f.read()
+    dims = dict(re.findall(r"#define\s+\w*?_(WIDTH|HEIGHT)\s+(\d+)", src))
+    body = re.search(r"uint16_t\s+\w+\[\d*\]\s*(?:PROGMEM)?\s*=\s*\{(.*?)\}", src, re.S)
+    if "WIDTH" not in dims or "HEIGHT" not in dims or not body:
+        sys.exit(f"{path}: not a raw RGB565 bitmap header")
+    pixels = [int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\d+", body.group(1))]
+    w, h = int(dims["WIDTH"]), int(dims["HEIGHT"])
+    if len(pixels) != w * h:
+        sys.exit(f"{path}: expected {w * h} pixels, found {len(pixels)}")
+    # Keep pointing at the original artwork when re-encoding a raw header
+    origin = re.search(r"Auto-generated from (\S+)", src)
+    return w, h, pixels, origin.group(1) if origin else os.path.basename(path)
+
+
+def encode_row(row):
+    out = []
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_COUNT]
+            del literal[:MAX_COUNT]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(row):
+        run = 1
+        while i + run < len(row) and row[i + run] == row[i] and run < MAX_COUNT:
+            run += 1
+        if run >= MIN_RUN:
+            flush_literal()
+            out.append(RUN_FLAG | (run - 1))
+            out.append(row[i])
+            i += run
+        else:
+            literal.append(row[i])
+            i += 1
+    flush_literal()
+    return out
+
+
+def main():
+    if len(sys.argv) not in (4, 5):
+        sys.exit(__doc__)
+    src, dst, name = sys.argv[1:4]
+    prefix = sys.argv[4] if len(sys.argv) == 5 else name.upper()
+
+    if src.lower().endswith(".png"):
+        w, h, pixels, origin = load_png(src)
+    else:
+        w, h, pixels, origin = load_raw_header(src)
+
+    words = []
+    for y in range(h):
+        words.extend(encode_row(pixels[y * w:(y + 1) * w]))
+
+    lines = [
+        f"// Auto-generated from {origin} ({w}x{h}) by scripts/gen_rle_bitmap.py",
+        f"// {w * h * 2} bytes raw, {len(words) * 2} bytes encoded",
+        "#pragma once",
+        '#include "rle_bitmap.h"',
+        "",
+        f"#define {prefix}_WIDTH {w}",
+        f"#define {prefix}_HEIGHT {h}",
+        "",
+        f"const uint16_t {name}_rle[{len(words)}] PROGMEM = {{",
+    ]
+    for i in range(0, len(words), 16):
+        chunk = ",".join(f"0x{v:04X}" for v in words[i:i + 16])
+        lines.append(f"  {chunk}" + ("," if i + 16 < len(words) else ""))
+    lines += [
+        "};",
+        "",
+        f"constexpr RleBitmap {name} = {{ {prefix}_WIDTH, {prefix}_HEIGHT, {name}_rle }};",
+        "",
+    ]
+
+    with open(dst, "w") as f:
+        f.write("\n".join(lines))
+    print(f"{dst}: {w}x{h}, {w * h * 2} -> {len(words) * 2} bytes")
+
+
+if __name__ == "__main__":
+    main()
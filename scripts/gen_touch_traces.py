@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+"""Write synthetic touch traces for host/replay_touch.cpp.
+
+Usage:
+    gen_touch_traces.py [OUT_DIR]     (default host/traces/synthetic)
+
+Each trace is one take in the TouchRecorder format, sampled at 120 Hz in
+screen coordinates (320x172) with a little positional jitter, and labelled
+with the detectGesture() results and the readGesture() events (DRAG and
+PINCH updates left out) it should produce. These seed the library;
+real captures from the panel belong next to them (host/traces/<name>/).
+The output is deterministic so regenerating doesn't churn the tree.
+"""
+
+import math
+import os
+import random
+import sys
+
+SAMPLE_US = 8333
+W, H = 320, 172
+
+# GestureRecognizer's release velocity: newest sample against the oldest
+# one within VELOCITY_WINDOW_MS, FLING at FLING_MIN_VELOCITY and up
+VELOCITY_WINDOW_US = 80_000
+FLING_MIN_VELOCITY = 400.0
+
+
+def clamp(x, y):
+    return min(max(round(x), 0), W - 1), min(max(round(y), 0), H - 1)
+
+
+def stroke_at(rng, t, x0, y0, x1, y1, duration_ms, jitter=1.5, ease=True):
+    """Samples along a straight line starting at 't', with ease-in/out
+    unless 'ease' is off, then the lift. Returns the lines and the lift
+    time."""
+    n = max(2, round(duration_ms * 1000 / SAMPLE_US))
+    out = []
+    for i in range(n):
+        f = i / (n - 1)
+        if ease:
+            f = f * f * (3 - 2 * f)
+        x, y = clamp(x0 + (x1 - x0) * f + rng.gauss(0, jitter),
+                     y0 + (y1 - y0) * f + rng.gauss(0, jitter))
+        out.append(f"@t {t} 1 {x} {y}")
+        t += SAMPLE_US
+    out.append(f"@t {t} 0")
+    return out, t
+
+
+def stroke(rng, x0, y0, x1, y1, duration_ms, jitter=1.5, ease=True):
+    """stroke_at() from a random start time."""
+    t = rng.randrange(1_000_000, 5_000_000)
+    return stroke_at(rng, t, x0, y0, x1, y1, duration_ms, jitter, ease)[0]
+
+
+def taps(rng, spots, gaps_ms, hold_ms=80):
+    """A tap at each (x, y) in 'spots', 'gaps_ms' apart, lift to touch."""
+    t = rng.randrange(1_000_000, 5_000_000)
+    out = []
+    for i, (x, y) in enumerate(spots):
+        lines, t = stroke_at(rng, t, x, y, x, y, hold_ms)
+        out += lines
+        if i < len(gaps_ms):
+            t += gaps_ms[i] * 1000
+    return out
+
+
+def two_fingers(rng, t, centre, span, angle, duration_ms, jitter=1.0):
+    """Two-finger samples from 't' as centre, span and angle (radians,
+    counter-clockwise) each go linearly from their first value to their
+    second. Returns the lines, without a lift, and the time after."""
+    n = max(2, round(duration_ms * 1000 / SAMPLE_US))
+    out = []
+    for i in range(n):
+        f = i / (n - 1)
+        cx = centre[0] + (centre[2] - centre[0]) * f
+        cy = centre[1] + (centre[3] - centre[1]) * f
+        r = (span[0] + (span[1] - span[0]) * f) / 2
+        a = angle[0] + (angle[1] - angle[0]) * f
+        dx, dy = r * math.cos(a), -r * math.sin(a)   # screen y grows down
+        p0 = clamp(cx - dx + rng.gauss(0, jitter), cy - dy + rng.gauss(0, jitter))
+        p1 = clamp(cx + dx + rng.gauss(0, jitter), cy + dy + rng.gauss(0, jitter))
+        out.append(f"@t {t} 2 {p0[0]} {p0[1]} {p1[0]} {p1[1]}")
+        t += SAMPLE_US
+    return out, t
+
+
+def flings(lines):
+    """Whether the last touch in 'lines' is released fast enough to fling."""
+    points = []
+    for line in lines:
+        f = line.split()
+        if f[2] == "0":
+            break
+        points.append((int(f[1]), int(f[3]), int(f[4])))
+    last = points[-1]
+    first = last
+    for p in reversed(points[:-1]):
+        if last[0] - p[0] > VELOCITY_WINDOW_US:
+            break
+        first = p
+    dt = (last[0] - first[0]) / 1e6
+    if dt == 0:
+        return False
+    return math.hypot(last[1] - first[1], last[2] - first[2]) / dt >= FLING_MIN_VELOCITY
+
+
+def drag_events(lines):
+    return ["DRAG_START", "DRAG_END"] + (["FLING"] if flings(lines) else [])
+
+
+def takes(rng):
+    for i, (x, y) in enumerate([(160, 86), (30, 30), (290, 150)]):
+        yield f"tap_{i}", ["TAP"], ["TAP"], stroke(rng, x, y, x, y, rng.randrange(60, 160))
+    swipes = {
+        "SWIPE_RIGHT_TO_LEFT": (260, 86, 80, 86),
+        "SWIPE_LEFT_TO_RIGHT": (60, 86, 250, 86),
+        "SWIPE_TOP_TO_BOTTOM": (160, 20, 160, 150),
+        "SWIPE_BOTTOM_TO_TOP": (160, 150, 160, 20),
+    }
+    for name, (x0, y0, x1, y1) in swipes.items():
+        for speed, ms in (("fast", 120), ("medium", 250), ("slow", 420)):
+            # A little off-axis, as a thumb would be
+            drift = rng.randrange(-12, 13)
+            if y0 == y1:
+                path = (x0, y0, x1, y1 + drift)
+            else:
+                path = (x0, y0, x1 + drift, y1)
+            lines = stroke(rng, *path, ms)
+            yield f"{name.lower()}_{speed}", [name], drag_events(lines), lines
+    # Too slow for a swipe, too far for a tap: no gesture
+    lines = stroke(rng, 60, 86, 250, 86, 900)
+    yield "drag_too_slow", [], drag_events(lines), lines
+    # Short nudge past the tap slop but well short of a swipe
+    lines = stroke(rng, 160, 86, 185, 86, 150)
+    yield "nudge", [], drag_events(lines), lines
+
+    # Tap timing: DOUBLE_TAP_MS is release to release, so with 80 ms taps a
+    # 150 ms gap is well inside it and a 300 ms one well outside
+    yield ("double_tap", ["TAP", "TAP"], ["TAP", "TAP", "DOUBLE_TAP"],
+           taps(rng, [(160, 86), (163, 88)], [150]))
+    yield ("triple_tap", ["TAP"] * 3, ["TAP", "TAP", "DOUBLE_TAP", "TAP"],
+           taps(rng, [(160, 86)] * 3, [150, 150]))
+    yield ("double_tap_too_slow", ["TAP", "TAP"], ["TAP", "TAP"],
+           taps(rng, [(160, 86)] * 2, [300]))
+    yield ("double_tap_too_far", ["TAP", "TAP"], ["TAP", "TAP"],
+           taps(rng, [(100, 86), (180, 86)], [150]))
+    # A drag in between breaks up a double tap
+    t = rng.randrange(1_000_000, 5_000_000)
+    a, t = stroke_at(rng, t, 160, 86, 160, 86, 80)
+    b, t = stroke_at(rng, t + 100_000, 100, 86, 200, 86, 300)
+    c, t = stroke_at(rng, t + 100_000, 160, 86, 160, 86, 80)
+    yield "tap_drag_tap", ["TAP", "SWIPE_LEFT_TO_RIGHT", "TAP"], ["TAP"] + drag_events(b) + ["TAP"], a + b + c
+
+    # Held still: past TAP_MAX_MS is no tap; past LONG_PRESS_MS is a long
+    # press, decided while still held. The classifier has no upper limit
+    # on a tap.
+    yield "press_too_long_for_tap", ["TAP"], [], stroke(rng, 160, 86, 160, 86, 400)
+    yield "long_press", ["TAP"], ["LONG_PRESS"], stroke(rng, 160, 86, 160, 86, 800)
+    t = rng.randrange(1_000_000, 5_000_000)
+    hold, t = stroke_at(rng, t, 100, 86, 100, 86, 650)
+    drag, t = stroke_at(rng, t, 100, 86, 220, 86, 400)
+    yield "long_press_then_drag", [], ["LONG_PRESS"] + drag_events(drag), hold[:-1] + drag
+
+    # Constant speed to the lift, so the release is fast: a fling. Then the
+    # same distance, but held at the end before lifting: no fling.
+    lines = stroke(rng, 260, 86, 80, 86, 100, ease=False)
+    yield "fling", ["SWIPE_RIGHT_TO_LEFT"], ["DRAG_START", "DRAG_END", "FLING"], lines
+    t = rng.randrange(1_000_000, 5_000_000)
+    drag, t = stroke_at(rng, t, 80, 86, 260, 86, 200, ease=False)
+    hold, t = stroke_at(rng, t, 260, 86, 260, 86, 200, jitter=0.5)
+    yield "drag_and_hold", ["SWIPE_LEFT_TO_RIGHT"], ["DRAG_START", "DRAG_END"], drag[:-1] + hold
+
+    # Two fingers. The classifier only follows the first one.
+    t = rng.randrange(1_000_000, 5_000_000)
+    lines, t = two_fingers(rng, t, (160, 86, 160, 86), (40, 130), (0, 0), 300)
+    yield "pinch_out", [], ["PINCH_START", "PINCH_END"], lines + [f"@t {t} 0"]
+    t = rng.randrange(1_000_000, 5_000_000)
+    lines, t = two_fingers(rng, t, (160, 86, 160, 86), (120, 50), (0.3, 0.3), 300)
+    yield "pinch_in", [], ["PINCH_START", "PINCH_END"], lines + [f"@t {t} 0"]
+    t = rng.randrange(1_000_000, 5_000_000)
+    lines, t = two_fingers(rng, t, (160, 86, 160, 86), (60, 60), (0, 1.2), 400)
+    yield "rotate", [], ["PINCH_START", "PINCH_END"], lines + [f"@t {t} 0"]
+    # One finger drags, a second lands: the drag ends and a pinch starts
+    t = rng.randrange(1_000_000, 5_000_000)
+    drag, t = stroke_at(rng, t, 120, 86, 160, 86, 200, ease=False)
+    pinch, t = two_fingers(rng, t, (200, 86, 200, 86), (40, 100), (0, 0), 250)
+    yield "drag_then_pinch", [], ["DRAG_START", "DRAG_END", "PINCH_START", "PINCH_END"], \
+        drag[:-1] + pinch + [f"@t {t} 0"]
+    # One finger lifts first: the pinch ends there and the other finger's
+    # movement until its own lift is ignored
+    t = rng.randrange(1_000_000, 5_000_000)
+    pinch, t = two_fingers(rng, t, (160, 86, 160, 86), (50, 120), (0, 0), 250)
+    rest, t = stroke_at(rng, t, 100, 86, 40, 86, 400, ease=False)
+    yield "pinch_lift_one", [], ["PINCH_START", "PINCH_END"], pinch + rest
+
+
+def main():
+    out_dir = sys.argv[1] if len(sys.argv) > 1 else "host/traces/synthetic"
+    os.makedirs(out_dir, exist_ok=True)
+    rng = random.Random(1234)
+    for name, expect, events, lines in takes(rng):
+        with open(os.path.join(out_dir, name + ".trace"), "w") as f:
+            f.write("# synthetic trace from scripts/gen_touch_traces.py\n")
+            f.write("# expect: " + " ".join(expect) + "\n")
+            f.write("# events: " + " ".join(events) + "\n")
+            f.write("\n".join(lines) + "\n")
+    print(f"wrote traces to {out_dir}")
+
+
+if __name__ == "__main__":
+    main()
@@ -65,7 +65,10 @@ $FONTCONVERT Inter/extras/ttf/Inter-Bold.ttf 32 32 126 > Inter_Bold_32pt.h
 $FONTCONVERT JetBrainsMono/fonts/ttf/JetBrainsMono-Regular.ttf 12 32 126 > JetBrainsMono_Regular_12pt.h
 $FONTCONVERT JetBrainsMono/fonts/ttf/JetBrainsMono-Regular.ttf 16 32 126 > JetBrainsMono_Regular_16pt.h
 
-echo "6. Moving font files to project..."
+echo "6. Generating constexpr glyph metrics..."
+python3 "$PROJECT_DIR/scripts/gen_font_metrics.py" Inter_*.h JetBrainsMono_*.h
+
+echo "7. Moving font files to project..."
 mv *.h "$PROJECT_DIR/assets/fonts/"
 
 echo ""
@@ -18,4 +18,9 @@ bool AppState::shouldRevertToHome() const {
         return false;
     }
     return (millis() - tapped_time >= TAPPED_DISPLAY_DURATION);
+}
+
+unsigned long AppState::msUntilRevert() const {
+    unsigned long elapsed = millis() - tapped_time;
+    return elapsed >= TAPPED_DISPLAY_DURATION ? 0 : TAPPED_DISPLAY_DURATION - elapsed;
 }
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include "boot_profiler.h"
+#include "nvs_manager.h"
+#include <algorithm>
+
+static const char* NVS_NS  = "boot";
+static const char* NVS_KEY = "history";
+
+static const char* PHASE_NAMES[] = {
+    "hosted_link", "c6_check", "eth_dhcp", "wifi_assoc",
+    "internet_probe", "mqtt_cache", "ready"
+};
+static_assert(sizeof(PHASE_NAMES) / sizeof(PHASE_NAMES[0]) == (size_t)BootPhase::COUNT,
+              "a name per boot phase");
+
+BootProfiler& BootProfiler::instance() {
+    static BootProfiler inst;
+    return inst;
+}
+
+BootProfiler::BootProfiler() {
+    for (uint8_t i = 0; i < PHASES; i++) {
+        start_ms_[i] = 0;
+        current_.ms[i] = NOT_RUN;
+    }
+    memset(&history_, 0, sizeof(history_));
+}
+
+const char* BootProfiler::phaseName(BootPhase p) {
+    return PHASE_NAMES[(uint8_t)p];
+}
+
+void BootProfiler::begin(BootPhase p) {
+    if (committed_) return;
+    uint8_t i = (uint8_t)p;
+    start_ms_[i] = millis();
+    running_.fetch_or(1u << i, std::memory_order_relaxed);
+}
+
+void BootProfiler::end(BootPhase p) {
+    if (committed_) return;
+    uint8_t i = (uint8_t)p;
+    // Only the first end() after a begin() counts; event handlers may
+    // report the same thing again later
+    if (!(running_.fetch_and(~(1u << i), std::memory_order_relaxed) & (1u << i))) return;
+    uint32_t total = millis() - start_ms_[i];
+    if (current_.ms[i] != NOT_RUN) total += current_.ms[i];
+    current_.ms[i] = (uint16_t)std::min<uint32_t>(total, NOT_RUN - 1);
+}
+
+void BootProfiler::load() {
+    if (loaded_) return;
+    loaded_ = true;
+    NvsManager::instance().registerNamespace(NVS_NS);
+    size_t len = NvsManager::instance().getBlob(NVS_NS, NVS_KEY, &history_, sizeof(history_));
+    if (len != sizeof(history_) || history_.version != STORE_VERSION ||
+        history_.head >= HISTORY_LEN || history_.count > HISTORY_LEN) {
+        // Missing, or from a build with a different layout: start over
+        memset(&history_, 0, sizeof(history_));
+        history_.version = STORE_VERSION;
+    }
+}
+
+void BootProfiler::commit() {
+    if (committed_) return;
+    current_.ms[(uint8_t)BootPhase::READY] = (uint16_t)std::min<uint32_t>(millis(), NOT_RUN - 1);
+    committed_ = true;
+
+    load();
+    history_.records[history_.head] = current_;
+    history_.head = (history_.head + 1) % HISTORY_LEN;
+    if (history_.count < HISTORY_LEN) history_.count++;
+    if (!NvsManager::instance().putBlob(NVS_NS, NVS_KEY, &history_, sizeof(history_))) {
+        Serial.println("[boot] history save failed");
+    }
+}
+
+uint8_t BootProfiler::count() {
+    load();
+    return history_.count;
+}
+
+const BootProfiler::Record& BootProfiler::record(uint8_t i) {
+    load();
+    uint8_t oldest = (history_.head + HISTORY_LEN - history_.count) % HISTORY_LEN;
+    return history_.records[(oldest + i) % HISTORY_LEN];
+}
+
+uint16_t BootProfiler::percentile(BootPhase p, uint8_t pct) {
+    load();
+    uint16_t values[HISTORY_LEN];
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < history_.count; i++) {
+        uint16_t v = history_.records[i].ms[(uint8_t)p];
+        if (v != NOT_RUN) values[n++] = v;
+    }
+    if (n == 0) return NOT_RUN;
+    std::sort(values, values + n);
+    uint8_t rank = (uint8_t)((pct * n + 99) / 100);   // nearest rank, 1-based
+    return values[rank > 0 ? rank - 1 : 0];
+}
+
+static void writeValue(JsonWriter& w, uint16_t v) {
+    if (v == BootProfiler::NOT_RUN) w.null();
+    else                            w.value(v);
+}
+
+void BootProfiler::toJson(JsonWriter& w, bool history) {
+    load();
+    w.beginObject().key("phases").beginArray();
+    for (uint8_t i = 0; i < PHASES; i++) w.value(PHASE_NAMES[i]);
+    w.endArray().field("n", history_.count);
+
+    const uint8_t pcts[] = { 50, 95 };
+    const char*   keys[] = { "p50", "p95" };
+    for (uint8_t k = 0; k < 2; k++) {
+        w.key(keys[k]).beginArray();
+        for (uint8_t i = 0; i < PHASES; i++) writeValue(w, percentile((BootPhase)i, pcts[k]));
+        w.endArray();
+    }
+
+    if (history) {
+        w.key("boots").beginArray();
+        for (uint8_t b = 0; b < history_.count; b++) {
+            w.beginArray();
+            const Record& r = record(b);
+            for (uint8_t i = 0; i < PHASES; i++) writeValue(w, r.ms[i]);
+            w.endArray();
+        }
+        w.endArray();
+    }
+    w.endObject();
+}
@@ -0,0 +1,96 @@
+#include "boot_sequencer.h"
+
+BootSequencer::BootSequencer() {
+    status_lock_ = portMUX_INITIALIZER_UNLOCKED;
+    status_[0] = '\0';
+}
+
+uint32_t BootSequencer::add(const char* name, BootStepFn fn, uint32_t after, uint32_t stack) {
+    if (count_ >= MAX_STEPS) {
+        Serial.printf("[boot] too many steps, dropped %s\n", name);
+        return 0;
+    }
+    Step& s = steps_[count_];
+    s.name     = name;
+    s.fn       = fn;
+    s.after    = after;
+    s.stack    = stack;
+    s.start_ms = 0;
+    s.end_ms   = 0;
+    s.owner    = this;
+    s.index    = count_;
+    return 1u << count_++;
+}
+
+void BootSequencer::setStatus(const char* status) {
+    portENTER_CRITICAL(&status_lock_);
+    strncpy(status_, status ? status : "", sizeof(status_) - 1);
+    status_[sizeof(status_) - 1] = '\0';
+    portEXIT_CRITICAL(&status_lock_);
+}
+
+void BootSequencer::taskEntry(void* arg) {
+    Step* s = static_cast<Step*>(arg);
+    BootSequencer* self = s->owner;
+    if (s->after) xEventGroupWaitBits(self->done_, s->after, pdFALSE, pdTRUE, portMAX_DELAY);
+    s->start_ms = millis() - self->begin_ms_;
+    s->fn();
+    s->end_ms = millis() - self->begin_ms_;
+    xEventGroupSetBits(self->done_, 1u << s->index);
+    vTaskDelete(nullptr);
+}
+
+void BootSequencer::run(BootTickFn tick) {
+    begin_ms_ = millis();
+    done_ = xEventGroupCreate();
+    if (!done_) {
+        // Nothing to coordinate through; dependency order is add() order
+        Serial.println("[boot] event group failed, running in sequence");
+        for (uint8_t i = 0; i < count_; i++) {
+            steps_[i].start_ms = millis() - begin_ms_;
+            steps_[i].fn();
+            steps_[i].end_ms = millis() - begin_ms_;
+        }
+        total_ms_ = millis() - begin_ms_;
+        return;
+    }
+
+    uint32_t all = 0;
+    for (uint8_t i = 0; i < count_; i++) {
+        all |= 1u << i;
+        if (xTaskCreate(taskEntry, steps_[i].name, steps_[i].stack, &steps_[i],
+                        TASK_PRIORITY, nullptr) != pdPASS) {
+            // Run it here instead; its dependencies were all added (and
+            // started) before it
+            Serial.printf("[boot] %s: task create failed, running inline\n", steps_[i].name);
+            if (steps_[i].after) xEventGroupWaitBits(done_, steps_[i].after, pdFALSE, pdTRUE, portMAX_DELAY);
+            steps_[i].start_ms = millis() - begin_ms_;
+            steps_[i].fn();
+            steps_[i].end_ms = millis() - begin_ms_;
+            xEventGroupSetBits(done_, 1u << i);
+        }
+    }
+
+    char status[sizeof(status_)];
+    for (;;) {
+        EventBits_t bits = xEventGroupWaitBits(done_, all, pdFALSE, pdTRUE, pdMS_TO_TICKS(TICK_MS));
+        if ((bits & all) == all) break;
+        if (!tick) continue;
+        portENTER_CRITICAL(&status_lock_);
+        memcpy(status, status_, sizeof(status));
+        portEXIT_CRITICAL(&status_lock_);
+        tick(millis() - begin_ms_, status);
+    }
+    total_ms_ = millis() - begin_ms_;
+    vEventGroupDelete(done_);
+    done_ = nullptr;
+}
+
+void BootSequencer::report() const {
+    for (uint8_t i = 0; i < count_; i++) {
+        const Step& s = steps_[i];
+        Serial.printf("[boot] %-10s %5lu ms  (at %lu ms)\n", s.name,
+                      (unsigned long)(s.end_ms - s.start_ms), (unsigned long)s.start_ms);
+    }
+    Serial.printf("[boot] total      %5lu ms\n", (unsigned long)total_ms_);
+}
@@ -0,0 +1,250 @@
+#include "connectivity_probe.h"
+#include <WiFi.h>
+#include <ETH.h>
+#include <algorithm>
+
+// ScoreScrape API ping — returns 200 with "Pong!" body.
+static const char* PING_HOST     = "api.scorescrape.io";
+static const char* PING_PATH     = "/ping";
+static const char* PING_RESPONSE = "Pong!";
+
+// Plain-HTTP 204 endpoint; anything else (redirect, login page) means a
+// captive portal or no internet
+static const char* PLAIN_HOST = "connectivitycheck.gstatic.com";
+static const char* PLAIN_PATH = "/generate_204";
+
+ConnectivityProbe::ConnectivityProbe()
+    : ping_host_{PING_HOST, IPAddress(), 0, false},
+      plain_host_{PLAIN_HOST, IPAddress(), 0, false} {
+    for (uint8_t i = 0; i < IFACES; i++) tls_[i].setInsecure();
+}
+
+bool ConnectivityProbe::begin() {
+    if (lock_) return true;
+    lock_ = xSemaphoreCreateMutex();
+    if (!lock_) return false;
+    if (xTaskCreatePinnedToCore(taskEntry, "probe", TASK_STACK, this,
+                                TASK_PRIORITY, &task_, TASK_CORE) != pdPASS) {
+        Serial.println("[net]  probe task create failed");
+        task_ = nullptr;
+    }
+    return true;
+}
+
+ProbeResult ConnectivityProbe::check(ProbeIface iface, ProbeKind kind, uint32_t timeout_ms) {
+    if (lock_) xSemaphoreTake(lock_, portMAX_DELAY);
+    ProbeResult r = run(iface, kind, timeout_ms);
+    if (lock_) xSemaphoreGive(lock_);
+    return r;
+}
+
+bool ConnectivityProbe::checkAsync(ProbeIface iface, ProbeKind kind, uint32_t timeout_ms,
+                                   ProbeCallback cb, void* ctx) {
+    if (!task_ || async_busy_) return false;
+    async_iface_      = iface;
+    async_kind_       = kind;
+    async_timeout_ms_ = timeout_ms;
+    async_cb_         = cb;
+    async_ctx_        = ctx;
+    async_busy_       = true;
+    xTaskNotifyGive(task_);
+    return true;
+}
+
+void ConnectivityProbe::reset(ProbeIface iface) {
+    if (lock_) xSemaphoreTake(lock_, portMAX_DELAY);
+    tls_[(uint8_t)iface].stop();
+    plain_[(uint8_t)iface].stop();
+    if (lock_) xSemaphoreGive(lock_);
+}
+
+void ConnectivityProbe::taskEntry(void* arg) {
+    static_cast<ConnectivityProbe*>(arg)->runAsync();
+}
+
+void ConnectivityProbe::runAsync() {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (!async_busy_) continue;
+
+        ProbeIface    iface = async_iface_;
+        ProbeCallback cb    = async_cb_;
+        void*         ctx   = async_ctx_;
+        ProbeResult   r     = check(iface, async_kind_, async_timeout_ms_);
+
+        async_busy_ = false;
+        if (cb) cb(iface, r, ctx);
+    }
+}
+
+// -- Probe ------------------------------------------------------------------
+
+ProbeResult ConnectivityProbe::run(ProbeIface iface, ProbeKind kind, uint32_t timeout_ms) {
+    uint32_t start    = millis();
+    uint32_t deadline = start + timeout_ms;
+    uint8_t  i        = (uint8_t)iface;
+
+    NetworkInterface* route = Network.getDefaultInterface();
+    if (iface == ProbeIface::ETHERNET) Network.setDefaultInterface(ETH);
+    else                               Network.setDefaultInterface(WiFi.STA);
+
+    ProbeResult r = { false, 0, 0 };
+    char body[16];
+
+    if (kind == ProbeKind::PLAIN_204) {
+        r.status = request(plain_[i], false, plain_host_, 80, PLAIN_PATH,
+                           body, sizeof(body), deadline);
+        r.online = r.status == 204;
+    } else {
+        r.status = request(tls_[i], true, ping_host_, 443, PING_PATH,
+                           body, sizeof(body), deadline);
+        r.online = r.status == 200 && strcmp(body, PING_RESPONSE) == 0;
+        if (r.status == 200 && !r.online)
+            Serial.printf("[net]  ping: unexpected response '%s'\n", body);
+        else if (r.status != 200)
+            Serial.printf("[net]  ping: http %d\n", r.status);
+    }
+
+    if (route) Network.setDefaultInterface(*route);
+    r.ms = (uint16_t)std::min<uint32_t>(millis() - start, 0xFFFF);
+    return r;
+}
+
+bool ConnectivityProbe::resolve(Host& host) {
+    if (host.valid && millis() - host.resolved_ms < DNS_TTL_MS) return true;
+    IPAddress addr;
+    if (!Network.hostByName(host.name, addr)) {
+        host.valid = false;
+        return false;
+    }
+    host.addr        = addr;
+    host.resolved_ms = millis();
+    host.valid       = true;
+    return true;
+}
+
+bool ConnectivityProbe::readLine(WiFiClient& client, char* buf, size_t len,
+                                 uint32_t deadline) {
+    size_t n = 0;
+    while ((int32_t)(deadline - millis()) > 0) {
+        if (!client.available()) {
+            if (!client.connected()) return false;
+            delay(1);
+            continue;
+        }
+        int c = client.read();
+        if (c == '\n') {
+            if (n > 0 && buf[n - 1] == '\r') n--;
+            buf[n] = '\0';
+            return true;
+        }
+        if (n < len - 1) buf[n++] = (char)c;   // long lines are cut, not failed
+    }
+    return false;
+}
+
+int ConnectivityProbe::request(WiFiClient& client, bool tls, Host& host, uint16_t port,
+                               const char* path, char* body, size_t body_len,
+                               uint32_t deadline) {
+    body[0] = '\0';
+
+    // A kept-alive connection the server has since closed fails on first
+    // use; one retry on a fresh connection covers that
+    for (uint8_t attempt = 0; attempt < 2; attempt++) {
+        bool reused = client.connected();
+        if (!reused) {
+            client.stop();
+            if (!resolve(host)) return 0;
+            int32_t left = (int32_t)(deadline - millis());
+            if (left <= 0) return 0;
+            bool ok;
+            if (tls) {
+                auto& secure = static_cast<WiFiClientSecure&>(client);
+                secure.setHandshakeTimeout((left + 999) / 1000);
+                ok = secure.connect(host.addr, port, host.name, nullptr, nullptr, nullptr);
+            } else {
+                ok = client.connect(host.addr, port, left);
+            }
+            if (!ok) {
+                // The address may have moved
+                host.valid = false;
+                return 0;
+            }
+        }
+
+        client.printf("GET %s HTTP/1.1\r\nHost: %s\r\nConnection: keep-alive\r\n\r\n",
+                      path, host.name);
+
+        char line[96];
+        if (!readLine(client, line, sizeof(line), deadline)) {
+            client.stop();
+            if (reused) continue;
+            return 0;
+        }
+        int status = 0;
+        if (sscanf(line, "HTTP/%*d.%*d %d", &status) != 1) {
+            client.stop();
+            return 0;
+        }
+
+        int32_t content_len = -1;
+        bool    chunked     = false;
+        bool    keep        = true;
+        while (readLine(client, line, sizeof(line), deadline)) {
+            if (!line[0]) break;   // end of headers
+            for (char* p = line; *p; p++) *p = tolower((unsigned char)*p);
+            if (strncmp(line, "content-length:", 15) == 0)
+                content_len = atoi(line + 15);
+            else if (strncmp(line, "transfer-encoding:", 18) == 0 && strstr(line, "chunked"))
+                chunked = true;
+            else if (strncmp(line, "connection:", 11) == 0 && strstr(line, "close"))
+                keep = false;
+        }
+        if (status == 204 || status == 304) content_len = 0;
+
+        // Read the whole body so the connection is ready for the next
+        // request, keeping the start of it
+        size_t n    = 0;
+        bool   done = false;
+        if (chunked) {
+            for (;;) {
+                if (!readLine(client, line, sizeof(line), deadline)) break;
+                int32_t size = strtol(line, nullptr, 16);
+                if (size == 0) {
+                    done = readLine(client, line, sizeof(line), deadline);   // trailer
+                    break;
+                }
+                if (!readBody(client, size, body, body_len, n, deadline)) break;
+                if (!readLine(client, line, sizeof(line), deadline)) break;  // chunk CRLF
+            }
+        } else if (content_len >= 0) {
+            done = readBody(client, content_len, body, body_len, n, deadline);
+        } else {
+            // Length unknown: the server marks the end by closing
+            readBody(client, -1, body, body_len, n, deadline);
+            keep = false;
+        }
+        body[n] = '\0';
+        while (n > 0 && isspace((unsigned char)body[n - 1])) body[--n] = '\0';
+
+        if (!keep || !done) client.stop();
+        return status;
+    }
+    return 0;
+}
+
+bool ConnectivityProbe::readBody(WiFiClient& client, int32_t len, char* body,
+                                 size_t body_len, size_t& n, uint32_t deadline) {
+    while (len != 0 && (int32_t)(deadline - millis()) > 0) {
+        if (!client.available()) {
+            if (!client.connected()) break;
+            delay(1);
+            continue;
+        }
+        int c = client.read();
+        if (c < 0) break;
+        if (n < body_len - 1) body[n++] = (char)c;
+        if (len > 0) len--;
+    }
+    return len == 0;
+}
@@ -2,27 +2,27 @@
 #include "board_config.h"
 #include "display_config.h"
 #include "display_context.h"
+#include "font_metrics.h"
 #include "screens/boot_screen.h"
 #include "screens/connect_to_network_screen.h"
 #include "screens/onboarding_screen.h"
 #include "screens/home_screen.h"
 #include "screens/gesture_screen.h"
 
-Display::Display() : bus(nullptr), gfx(nullptr), dc(nullptr) {
-    bus = new Arduino_SWSPI(
-        PIN_LCD_DC, PIN_LCD_CS, PIN_LCD_SCLK, PIN_LCD_MOSI, GFX_NOT_DEFINED);
-
-    gfx = new Arduino_ST7789(
-        bus, PIN_LCD_RST, 0, false,
-        172, 320,
-        34, 0, 34, 0);
+static constexpr DisplayContext::StaticText TAPPED = staticText<DisplayContext::FONT_LARGE>("tapped");
+static constexpr DisplayContext::StaticText SWIPED = staticText<DisplayContext::FONT_LARGE>("swiped");
+
+Display::Display()
+    : bus(new Arduino_SWSPI(
+          PIN_LCD_DC, PIN_LCD_CS, PIN_LCD_SCLK, PIN_LCD_MOSI, GFX_NOT_DEFINED)),
+      gfx(new Arduino_ST7789(
+          bus, PIN_LCD_RST, 0, false,
+          172, 320,
+          34, 0, 34, 0)),
+      dc(gfx) {
 }
 
 Display::~Display() {
-    if (status_canvas_) {
-        delete status_canvas_;
-        status_canvas_ = nullptr;
-    }
     delete gfx;
     delete bus;
 }
@@ -35,15 +35,9 @@ bool Display::begin() {
     gfx->setRotation(1);
     applyColorFix();
 
-    dc = DisplayContext(gfx);
+    // Back buffer is sized from the rotated panel, so enable after setRotation
     dc.enableDoubleBuffer(true);
 
-    status_canvas_ = new Arduino_Canvas(SCREEN_W, 24, gfx, 0, SCREEN_H - 24, 0);
-    if (status_canvas_ && !status_canvas_->begin(GFX_SKIP_OUTPUT_BEGIN)) {
-        delete status_canvas_;
-        status_canvas_ = nullptr;
-    }
-
     return true;
 }
 
@@ -55,29 +49,33 @@ void Display::applyColorFix() {
 }
 
 void Display::showBootScreen(const char* status) {
-    drawBootScreen(dc, gfx, status);
+    drawBootScreen(dc, status);
+}
+
+void Display::animateBootScreen(uint32_t elapsed_ms) {
+    drawBootProgress(dc, elapsed_ms);
 }
 
 void Display::showConnectToNetworkScreen(const char* apSsid) {
-    drawConnectToNetworkScreen(dc, gfx, apSsid);
+    drawConnectToNetworkScreen(dc, apSsid);
 }
 
 void Display::showOnboardingScreen(const char* code) {
-    drawOnboardingScreen(dc, gfx, code);
+    drawOnboardingScreen(dc, code);
 }
 
 void Display::updateOnboardingStatus(const char* msg) {
-    drawOnboardingStatus(status_canvas_, msg);
+    drawOnboardingStatus(dc, msg);
 }
 
 void Display::showHomeScreen() {
-    drawHomeScreen(dc, gfx);
+    drawHomeScreen(dc);
 }
 
 void Display::showTappedMessage() {
-    drawGestureMessage(dc, gfx, "tapped");
+    drawGestureMessage(dc, TAPPED);
 }
 
 void Display::showSwipedMessage() {
-    drawGestureMessage(dc, gfx, "swiped");
+    drawGestureMessage(dc, SWIPED);
 }
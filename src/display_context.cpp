@@ -4,76 +4,208 @@
 DisplayContext::DisplayContext(Arduino_GFX* gfx) 
     : _gfx(gfx), _fgColor(0xFFFF), _bgColor(0x0000),
       _doubleBufferEnabled(false), _isDrawingToBuffer(false),
-      _backBuffer(nullptr), _bufferWidth(0), _bufferHeight(0) {
+      _canvas(nullptr), _backBuffer(nullptr),
+      _bufferWidth(0), _bufferHeight(0), _dirtyCount(0), _clipDepth(0), _clipOverflow(0),
+      _textCache(), _textCacheClock(0), _textCacheHits(0), _textCacheMisses(0) {
+}
+
+DisplayContext::~DisplayContext() {
+    freeDoubleBuffer();
 }
 
 void DisplayContext::clear() {
-    _gfx->fillScreen(_bgColor);
+    Rect c = currentClip();
+    if (_clipDepth == 0) {
+        target()->fillScreen(_bgColor);
+    } else {
+        target()->fillRect(c.x, c.y, c.w, c.h, _bgColor);
+    }
+    markDirty(c.x, c.y, c.w, c.h);
 }
 
 void DisplayContext::setColor(uint16_t foreground, uint16_t background) {
     _fgColor = foreground;
     _bgColor = background;
-    _gfx->setTextColor(foreground, background);
+    target()->setTextColor(foreground, background);
 }
 
 void DisplayContext::drawText(int16_t x, int16_t y, Font font, const char* text, uint8_t justification) {
     const GFXfont* gfxFont = getFontForSize(font);
-    _gfx->setFont(gfxFont);
-    _gfx->setTextColor(_fgColor);
     
     int16_t finalX, finalY;
-    calculateTextPosition(x, y, text, gfxFont, justification, &finalX, &finalY);
-    
-    _gfx->setCursor(finalX, finalY);
-    _gfx->print(text);
+    Rect bounds;
+    calculateTextPosition(x, y, measureText(text, gfxFont), justification,
+                          &finalX, &finalY, &bounds);
+    renderText(finalX, finalY, text, gfxFont, bounds);
+}
+
+void DisplayContext::drawText(int16_t x, int16_t y, const StaticText& text, uint8_t justification) {
+    int16_t finalX, finalY;
+    Rect bounds;
+    calculateTextPosition(x, y, text.bounds, justification, &finalX, &finalY, &bounds);
+    renderText(finalX, finalY, text.text, getFontForSize(text.font), bounds);
 }
 
 void DisplayContext::fillRectangle(int16_t x, int16_t y, int16_t width, int16_t height) {
-    _gfx->fillRect(x, y, width, height, _fgColor);
+    fillClipped(x, y, width, height);
 }
 
 void DisplayContext::fillCircle(int16_t x, int16_t y, int16_t radius) {
-    _gfx->fillCircle(x, y, radius, _fgColor);
+    Rect box = { (int16_t)(x - radius), (int16_t)(y - radius),
+                 (int16_t)(radius * 2 + 1), (int16_t)(radius * 2 + 1) };
+    Rect visible = box;
+    if (!clipToCurrent(visible)) return;
+
+    if (visible.w == box.w && visible.h == box.h) {
+        target()->fillCircle(x, y, radius, _fgColor);
+    } else {
+        fillCircleClipped(x, y, radius);
+    }
+    markDirty(visible.x, visible.y, visible.w, visible.h);
 }
 
 void DisplayContext::drawCircle(int16_t x, int16_t y, int16_t radius) {
-    _gfx->drawCircle(x, y, radius, _fgColor);
+    Rect box = { (int16_t)(x - radius), (int16_t)(y - radius),
+                 (int16_t)(radius * 2 + 1), (int16_t)(radius * 2 + 1) };
+    Rect visible = box;
+    if (!clipToCurrent(visible)) return;
+
+    if (visible.w == box.w && visible.h == box.h) {
+        target()->drawCircle(x, y, radius, _fgColor);
+    } else {
+        drawCircleClipped(x, y, radius);
+    }
+    markDirty(visible.x, visible.y, visible.w, visible.h);
 }
 
 void DisplayContext::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
-    _gfx->drawLine(x1, y1, x2, y2, _fgColor);
+    // Axis-aligned lines are just thin rectangles
+    if (x1 == x2 || y1 == y2) {
+        fillClipped(min(x1, x2), min(y1, y2), abs(x2 - x1) + 1, abs(y2 - y1) + 1);
+        return;
+    }
+
+    Rect box = { min(x1, x2), min(y1, y2),
+                 (int16_t)(abs(x2 - x1) + 1), (int16_t)(abs(y2 - y1) + 1) };
+    Rect visible = box;
+    if (!clipToCurrent(visible)) return;
+
+    if (visible.w == box.w && visible.h == box.h) {
+        target()->drawLine(x1, y1, x2, y2, _fgColor);
+    } else {
+        drawLineClipped(x1, y1, x2, y2);
+    }
+    markDirty(visible.x, visible.y, visible.w, visible.h);
 }
 
 void DisplayContext::drawRectangle(int16_t x, int16_t y, int16_t width, int16_t height) {
-    _gfx->drawRect(x, y, width, height, _fgColor);
+    if (width <= 0 || height <= 0) return;
+    fillClipped(x, y, width, 1);
+    fillClipped(x, y + height - 1, width, 1);
+    fillClipped(x, y, 1, height);
+    fillClipped(x + width - 1, y, 1, height);
 }
 
 void DisplayContext::drawBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) {
-    _gfx->draw16bitRGBBitmap(x, y, bitmap, w, h);
+    Rect r = { x, y, w, h };
+    if (!clipToCurrent(r)) return;
+
+    Arduino_GFX* g = target();
+    const uint16_t* src = bitmap + (int32_t)(r.y - y) * w + (r.x - x);
+    if (r.w == w) {
+        // Rows stay contiguous when only the top/bottom are trimmed
+        g->draw16bitRGBBitmap(r.x, r.y, (uint16_t*)src, r.w, r.h);
+    } else {
+        for (int16_t row = 0; row < r.h; row++) {
+            g->draw16bitRGBBitmap(r.x, r.y + row, (uint16_t*)(src + (int32_t)row * w), r.w, 1);
+        }
+    }
+    markDirty(r.x, r.y, r.w, r.h);
+}
+
+void DisplayContext::drawBitmap(int16_t x, int16_t y, const RleBitmap& bitmap) {
+    Rect r = { x, y, bitmap.width, bitmap.height };
+    if (!clipToCurrent(r)) return;
+
+    // Rows above the clip still have to be walked to find the visible ones
+    const uint16_t* src = bitmap.data;
+    for (int16_t row = y; row < r.y; row++) {
+        src = rleDecodeRow(src, bitmap.width, 0, 0, nullptr);
+    }
+
+    int16_t from = r.x - x;
+    if (_isDrawingToBuffer) {
+        uint16_t* dst = _backBuffer + (int32_t)r.y * _bufferWidth + r.x;
+        for (int16_t row = 0; row < r.h; row++, dst += _bufferWidth) {
+            src = rleDecodeRow(src, bitmap.width, from, r.w, dst);
+        }
+        markDirty(r.x, r.y, r.w, r.h);
+        return;
+    }
+
+    int16_t bandRows = max<int16_t>(1, BAND_PIXELS / r.w);
+    for (int16_t row = 0; row < r.h; row += bandRows) {
+        int16_t rows = min<int16_t>(bandRows, r.h - row);
+        for (int16_t i = 0; i < rows; i++) {
+            src = rleDecodeRow(src, bitmap.width, from, r.w, _band + (int32_t)i * r.w);
+        }
+        _gfx->draw16bitRGBBitmap(r.x, r.y + row, _band, r.w, rows);
+    }
 }
 
 void DisplayContext::setClip(int16_t x, int16_t y, int16_t width, int16_t height) {
-    // Arduino_GFX clipping via writeAddrWindow during startWrite
-    // This is a simplified implementation - full clipping would require
-    // checking bounds on every draw operation
+    Rect r = { x, y, width, height };
+    if (!clipToCurrent(r)) {
+        // Nothing visible — an empty clip rejects every draw
+        r = { 0, 0, 0, 0 };
+    }
+    if (_clipDepth == MAX_CLIP_DEPTH) {
+        // Too deep: counted so its clearClip() pairs up, but not applied,
+        // and the enclosing clip stays as it was
+        static bool warned = false;
+        if (!warned) {
+            warned = true;
+            Serial.printf("[disp] clips nested deeper than %u, ignoring\n",
+                          (unsigned)MAX_CLIP_DEPTH);
+        }
+        _clipOverflow++;
+        return;
+    }
+    _clipStack[_clipDepth++] = r;
 }
 
 void DisplayContext::clearClip() {
-    // Reset clipping region
+    if (_clipOverflow > 0) {
+        _clipOverflow--;
+        return;
+    }
+    if (_clipDepth > 0) _clipDepth--;
 }
 
 void DisplayContext::enableDoubleBuffer(bool enable) {
-    // For now, double buffering is handled by drawing operations
-    // being batched between startWrite/endWrite calls
     _doubleBufferEnabled = enable;
+    if (enable) {
+        initDoubleBuffer();
+    } else {
+        freeDoubleBuffer();
+    }
 }
 
 void DisplayContext::swapBuffers() {
-    // Flush any pending operations
-    if (_doubleBufferEnabled) {
-        _gfx->flush();
+    if (!_isDrawingToBuffer) return;
+
+    for (uint8_t i = 0; i < _dirtyCount; i++) {
+        flushRect(_dirty[i], i == _dirtyCount - 1);
     }
+    _dirtyCount = 0;
+}
+
+void DisplayContext::waitForFlush() {
+    if (_flush.isRunning()) _flush.waitIdle();
+}
+
+void DisplayContext::onFrameFlushed(FlushDoneCallback cb, void* ctx) {
+    _flush.onFrameDone(cb, ctx);
 }
 
 int16_t DisplayContext::getWidth() const {
@@ -85,15 +217,19 @@ int16_t DisplayContext::getHeight() const {
 }
 
 void DisplayContext::getTextDimensions(const char* text, Font font, int16_t* width, int16_t* height) {
-    const GFXfont* gfxFont = getFontForSize(font);
-    _gfx->setFont(gfxFont);
-    
-    int16_t x1, y1;
-    uint16_t w, h;
-    _gfx->getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+    const TextBounds& b = measureText(text, getFontForSize(font));
     
-    *width = w;
-    *height = h;
+    *width = b.w;
+    *height = b.h;
+}
+
+TextBounds DisplayContext::getTextBounds(const char* text, Font font) {
+    return measureText(text, getFontForSize(font));
+}
+
+void DisplayContext::getTextCacheStats(uint32_t* hits, uint32_t* misses) const {
+    *hits = _textCacheHits;
+    *misses = _textCacheMisses;
 }
 
 const GFXfont* DisplayContext::getFontForSize(Font font) {
@@ -108,14 +244,13 @@ const GFXfont* DisplayContext::getFontForSize(Font font) {
     }
 }
 
-void DisplayContext::calculateTextPosition(int16_t x, int16_t y, const char* text, 
-                                           const GFXfont* font, uint8_t justification,
-                                           int16_t* outX, int16_t* outY) {
-    _gfx->setFont(font);
-    
-    int16_t x1, y1;
-    uint16_t w, h;
-    _gfx->getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+void DisplayContext::calculateTextPosition(int16_t x, int16_t y, const TextBounds& text,
+                                           uint8_t justification,
+                                           int16_t* outX, int16_t* outY, Rect* outBounds) {
+    int16_t x1 = text.x1;
+    int16_t y1 = text.y1;
+    uint16_t w = text.w;
+    uint16_t h = text.h;
     
     // Horizontal justification
     if (justification & TEXT_JUSTIFY_CENTER) {
@@ -134,12 +269,419 @@ void DisplayContext::calculateTextPosition(int16_t x, int16_t y, const char* tex
     } else {
         *outY = y - y1;
     }
+
+    if (outBounds) {
+        outBounds->x = *outX + x1;
+        outBounds->y = *outY + y1;
+        outBounds->w = w;
+        outBounds->h = h;
+    }
+}
+
+// Same bounds Arduino_GFX::getTextBounds() (and measure<>() in
+// text_metrics.h) report for a single line, memoized. A hash match also
+// requires the same font and length.
+const TextBounds& DisplayContext::measureText(const char* text, const GFXfont* font) {
+    uint32_t hash = 2166136261u;  // FNV-1a
+    uint16_t length = 0;
+    for (const char* p = text; *p; p++, length++) {
+        hash = (hash ^ (uint8_t)*p) * 16777619u;
+    }
+
+    _textCacheClock++;
+    TextMetrics* victim = &_textCache[0];
+    for (uint8_t i = 0; i < TEXT_CACHE_SIZE; i++) {
+        TextMetrics& e = _textCache[i];
+        if (e.font == font && e.hash == hash && e.length == length) {
+            e.lastUse = _textCacheClock;
+            _textCacheHits++;
+            return e.bounds;
+        }
+        if (e.lastUse < victim->lastUse) victim = &e;
+    }
+    _textCacheMisses++;
+
+    int16_t minX = 0x7FFF, minY = 0x7FFF, maxX = -1, maxY = -1;
+    int16_t cursorX = 0;
+    for (const char* p = text; *p; p++) {
+        uint8_t ch = (uint8_t)*p;
+        if (ch < font->first || ch > font->last) continue;
+
+        const GFXglyph* glyph = &font->glyph[ch - font->first];
+        int16_t gx1 = cursorX + glyph->xOffset;
+        int16_t gy1 = glyph->yOffset;
+        int16_t gx2 = gx1 + glyph->width - 1;
+        int16_t gy2 = gy1 + glyph->height - 1;
+        if (gx1 < minX) minX = gx1;
+        if (gy1 < minY) minY = gy1;
+        if (gx2 > maxX) maxX = gx2;
+        if (gy2 > maxY) maxY = gy2;
+        cursorX += glyph->xAdvance;
+    }
+
+    victim->font    = font;
+    victim->hash    = hash;
+    victim->length  = length;
+    victim->lastUse = _textCacheClock;
+
+    TextBounds& b = victim->bounds;
+    b = { 0, 0, 0, 0 };
+    if (maxX >= minX) {
+        b.x1 = minX;
+        b.w  = maxX - minX + 1;
+    }
+    if (maxY >= minY) {
+        b.y1 = minY;
+        b.h  = maxY - minY + 1;
+    }
+    return b;
 }
 
 void DisplayContext::initDoubleBuffer() {
-    // Not needed with hardware-accelerated approach
+    if (_canvas) return;
+
+    _bufferWidth  = _gfx->width();
+    _bufferHeight = _gfx->height();
+
+    // Arduino_Canvas places its framebuffer in PSRAM when present. The
+    // output offset is unused: swapBuffers() pushes dirty regions itself.
+    _canvas = new Arduino_Canvas(_bufferWidth, _bufferHeight, _gfx, 0, 0, 0);
+    if (!_canvas || !_canvas->begin(GFX_SKIP_OUTPUT_BEGIN)) {
+        Serial.println("[disp] back buffer alloc failed, drawing direct");
+        freeDoubleBuffer();
+        return;
+    }
+    _backBuffer = _canvas->getFramebuffer();
+
+    if (!_flush.begin(_gfx, (size_t)_bufferWidth * FLUSH_LINES)) {
+        Serial.println("[disp] flush engine unavailable, drawing direct");
+        freeDoubleBuffer();
+        return;
+    }
+
+    _canvas->fillScreen(_bgColor);
+    _dirtyCount = 0;
+    _isDrawingToBuffer = true;
 }
 
 void DisplayContext::freeDoubleBuffer() {
-    // Not needed with hardware-accelerated approach
-}
\ No newline at end of file
+    _isDrawingToBuffer = false;
+    _dirtyCount = 0;
+    _flush.end();
+    if (_canvas) {
+        delete _canvas;
+        _canvas = nullptr;
+    }
+    _backBuffer = nullptr;
+}
+
+// -- Dirty tracking -----------------------------------------------------------
+
+static bool rectsNear(int16_t ax, int16_t ay, int16_t aw, int16_t ah,
+                      int16_t bx, int16_t by, int16_t bw, int16_t bh, int16_t gap) {
+    return ax <= bx + bw + gap && bx <= ax + aw + gap &&
+           ay <= by + bh + gap && by <= ay + ah + gap;
+}
+
+static int32_t unionArea(int16_t ax, int16_t ay, int16_t aw, int16_t ah,
+                         int16_t bx, int16_t by, int16_t bw, int16_t bh) {
+    int32_t w = max(ax + aw, bx + bw) - min(ax, bx);
+    int32_t h = max(ay + ah, by + bh) - min(ay, by);
+    return w * h;
+}
+
+void DisplayContext::markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (!_isDrawingToBuffer) return;
+
+    Rect r = { x, y, w, h };
+    if (!clipToCurrent(r)) return;
+
+    // Absorb every region that touches the new one. Restart after each
+    // merge since the grown rect may now reach ones already skipped.
+    uint8_t i = 0;
+    while (i < _dirtyCount) {
+        const Rect& d = _dirty[i];
+        if (rectsNear(d.x, d.y, d.w, d.h, r.x, r.y, r.w, r.h, DIRTY_MERGE_GAP)) {
+            int16_t nx = min(d.x, r.x);
+            int16_t ny = min(d.y, r.y);
+            r.w = max(d.x + d.w, r.x + r.w) - nx;
+            r.h = max(d.y + d.h, r.y + r.h) - ny;
+            r.x = nx;
+            r.y = ny;
+            _dirty[i] = _dirty[--_dirtyCount];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    if (_dirtyCount == MAX_DIRTY_RECTS) {
+        // Out of slots — fold into whichever region grows the least
+        uint8_t best = 0;
+        int32_t bestGrowth = INT32_MAX;
+        for (i = 0; i < _dirtyCount; i++) {
+            const Rect& d = _dirty[i];
+            int32_t growth = unionArea(d.x, d.y, d.w, d.h, r.x, r.y, r.w, r.h)
+                             - (int32_t)d.w * d.h;
+            if (growth < bestGrowth) {
+                bestGrowth = growth;
+                best = i;
+            }
+        }
+        Rect& d = _dirty[best];
+        int16_t nx = min(d.x, r.x);
+        int16_t ny = min(d.y, r.y);
+        d.w = max(d.x + d.w, r.x + r.w) - nx;
+        d.h = max(d.y + d.h, r.y + r.h) - ny;
+        d.x = nx;
+        d.y = ny;
+        return;
+    }
+
+    _dirty[_dirtyCount++] = r;
+}
+
+void DisplayContext::flushRect(const Rect& r, bool lastInFrame) {
+    // Pack the region into tiles, each a single address window. acquireTile()
+    // hands back whichever tile the flush task finished with, so packing
+    // tile N+1 overlaps with tile N going out over the bus.
+    int16_t linesPerTile = min<int16_t>(r.h, (int16_t)(_flush.tilePixels() / r.w));
+    for (int16_t row = 0; row < r.h; row += linesPerTile) {
+        int16_t lines = min<int16_t>(linesPerTile, r.h - row);
+        uint16_t* tile = _flush.acquireTile();
+        if (r.w == _bufferWidth) {
+            memcpy(tile, _backBuffer + (int32_t)(r.y + row) * _bufferWidth,
+                   (size_t)lines * r.w * sizeof(uint16_t));
+        } else {
+            for (int16_t l = 0; l < lines; l++) {
+                memcpy(tile + (int32_t)l * r.w,
+                       _backBuffer + (int32_t)(r.y + row + l) * _bufferWidth + r.x,
+                       r.w * sizeof(uint16_t));
+            }
+        }
+        _flush.submitTile(tile, r.x, r.y + row, r.w, lines,
+                          lastInFrame && row + lines >= r.h);
+    }
+}
+
+// -- Clipping -----------------------------------------------------------------
+
+DisplayContext::Rect DisplayContext::currentClip() const {
+    if (_clipDepth > 0) return _clipStack[_clipDepth - 1];
+    return { 0, 0, getWidth(), getHeight() };
+}
+
+bool DisplayContext::clipToCurrent(Rect& r) const {
+    Rect c = currentClip();
+    int16_t x0 = max(r.x, c.x);
+    int16_t y0 = max(r.y, c.y);
+    int16_t x1 = min(r.x + r.w, c.x + c.w);
+    int16_t y1 = min(r.y + r.h, c.y + c.h);
+    if (x1 <= x0 || y1 <= y0) return false;
+    r = { x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0) };
+    return true;
+}
+
+void DisplayContext::fillClipped(int16_t x, int16_t y, int16_t w, int16_t h) {
+    Rect r = { x, y, w, h };
+    if (!clipToCurrent(r)) return;
+    target()->fillRect(r.x, r.y, r.w, r.h, _fgColor);
+    markDirty(r.x, r.y, r.w, r.h);
+}
+
+// The partial-draw helpers below follow the same rasterization as
+// Arduino_GFX so a shape looks identical whether or not it was clipped.
+
+void DisplayContext::renderText(int16_t x, int16_t y, const char* text, const GFXfont* font,
+                                const Rect& bounds) {
+    Rect visible = bounds;
+    if (!clipToCurrent(visible)) return;
+
+    if (_isDrawingToBuffer) {
+        rasterizeText(x, y, text, font, visible, _backBuffer, 0, 0, _bufferWidth);
+        markDirty(visible.x, visible.y, visible.w, visible.h);
+        return;
+    }
+
+    // Direct to the panel: one window per band of rows of the glyph box
+    int16_t bandRows = max<int16_t>(1, BAND_PIXELS / visible.w);
+    for (int16_t row = 0; row < visible.h; row += bandRows) {
+        Rect band = { visible.x, (int16_t)(visible.y + row), visible.w,
+                      min<int16_t>(bandRows, visible.h - row) };
+        size_t count = (size_t)band.w * band.h;
+        for (size_t i = 0; i < count; i++) _band[i] = _bgColor;
+        rasterizeText(x, y, text, font, band, _band, band.x, band.y, band.w);
+        _gfx->draw16bitRGBBitmap(band.x, band.y, _band, band.w, band.h);
+    }
+}
+
+// Writes the set bits of each glyph row as runs of _fgColor into 'dst',
+// a surface whose top-left pixel is (dstX, dstY). Only pixels inside 'area'
+// are touched, so glyphs and rows outside it cost nothing but a bounds test.
+void DisplayContext::rasterizeText(int16_t x, int16_t y, const char* text, const GFXfont* font,
+                                   const Rect& area, uint16_t* dst, int16_t dstX, int16_t dstY,
+                                   int32_t stride) {
+    const int16_t areaRight  = area.x + area.w;
+    const int16_t areaBottom = area.y + area.h;
+    const uint16_t color = _fgColor;
+
+    int16_t cursorX = x;
+    for (const char* p = text; *p; p++) {
+        uint8_t ch = (uint8_t)*p;
+        if (ch < font->first || ch > font->last) continue;
+
+        const GFXglyph* glyph = &font->glyph[ch - font->first];
+        int16_t gx = cursorX + glyph->xOffset;
+        int16_t gy = y + glyph->yOffset;
+        int16_t gw = glyph->width;
+        cursorX += glyph->xAdvance;
+
+        if (gx >= areaRight || gx + gw <= area.x ||
+            gy >= areaBottom || gy + glyph->height <= area.y) continue;
+
+        // Glyph rows are packed back to back MSB-first, so any row can be
+        // addressed directly by its bit offset
+        const uint8_t* bits = font->bitmap + glyph->bitmapOffset;
+        int16_t rowStart = max<int16_t>(0, area.y - gy);
+        int16_t rowEnd   = min<int16_t>(glyph->height, areaBottom - gy);
+
+        for (int16_t row = rowStart; row < rowEnd; row++) {
+            uint16_t* line = dst + (int32_t)(gy + row - dstY) * stride - dstX;
+            uint32_t bit = (uint32_t)row * gw;
+            int16_t runStart = -1;
+
+            for (int16_t col = 0; col <= gw; col++, bit++) {
+                bool on = col < gw && (bits[bit >> 3] & (0x80 >> (bit & 7)));
+                if (on) {
+                    if (runStart < 0) runStart = col;
+                    continue;
+                }
+                if (runStart < 0) continue;
+
+                int16_t sx = max<int16_t>(gx + runStart, area.x);
+                int16_t ex = min<int16_t>(gx + col, areaRight);
+                for (int16_t px = sx; px < ex; px++) line[px] = color;
+                runStart = -1;
+            }
+        }
+    }
+}
+
+void DisplayContext::drawLineClipped(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    Rect c = currentClip();
+    Arduino_GFX* g = target();
+
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+
+    int16_t dx = x1 - x0;
+    int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = (y0 < y1) ? 1 : -1;
+
+    g->startWrite();
+    for (; x0 <= x1; x0++) {
+        int16_t px = steep ? y0 : x0;
+        int16_t py = steep ? x0 : y0;
+        if (px >= c.x && px < c.x + c.w && py >= c.y && py < c.y + c.h) {
+            g->writePixel(px, py, _fgColor);
+        }
+        err -= dy;
+        if (err < 0) {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+    g->endWrite();
+}
+
+void DisplayContext::drawCircleClipped(int16_t x0, int16_t y0, int16_t r) {
+    Rect c = currentClip();
+    Arduino_GFX* g = target();
+    auto plot = [&](int16_t px, int16_t py) {
+        if (px >= c.x && px < c.x + c.w && py >= c.y && py < c.y + c.h) {
+            g->writePixel(px, py, _fgColor);
+        }
+    };
+
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+
+    g->startWrite();
+    plot(x0, y0 + r);
+    plot(x0, y0 - r);
+    plot(x0 + r, y0);
+    plot(x0 - r, y0);
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        plot(x0 + x, y0 + y);
+        plot(x0 - x, y0 + y);
+        plot(x0 + x, y0 - y);
+        plot(x0 - x, y0 - y);
+        plot(x0 + y, y0 + x);
+        plot(x0 - y, y0 + x);
+        plot(x0 + y, y0 - x);
+        plot(x0 - y, y0 - x);
+    }
+    g->endWrite();
+}
+
+void DisplayContext::fillCircleClipped(int16_t x0, int16_t y0, int16_t r) {
+    Rect c = currentClip();
+    Arduino_GFX* g = target();
+    auto vline = [&](int16_t x, int16_t y, int16_t h) {
+        int16_t top = max(y, c.y);
+        int16_t bottom = min<int16_t>(y + h, c.y + c.h);
+        if (x < c.x || x >= c.x + c.w || bottom <= top) return;
+        g->writeFastVLine(x, top, bottom - top, _fgColor);
+    };
+
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    int16_t px = x;
+    int16_t py = y;
+
+    g->startWrite();
+    vline(x0, y0 - r, 2 * r + 1);
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        if (x < (y + 1)) {
+            vline(x0 + x, y0 - y, 2 * y + 1);
+            vline(x0 - x, y0 - y, 2 * y + 1);
+        }
+        if (y != py) {
+            vline(x0 + py, y0 - px, 2 * px + 1);
+            vline(x0 - py, y0 - px, 2 * px + 1);
+            py = y;
+        }
+        px = x;
+    }
+    g->endWrite();
+}
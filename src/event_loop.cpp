@@ -0,0 +1,35 @@
+#include "event_loop.h"
+
+bool EventLoop::begin() {
+    if (!group_) group_ = xEventGroupCreate();
+    return group_ != nullptr;
+}
+
+void EventLoop::post(EventBits_t bits) {
+    if (group_) xEventGroupSetBits(group_, bits);
+}
+
+void EventLoop::wakeIn(uint32_t ms) {
+    uint32_t at = millis() + ms;
+    if (!has_deadline_ || (int32_t)(at - deadline_ms_) < 0) {
+        deadline_ms_ = at;
+        has_deadline_ = true;
+    }
+}
+
+EventBits_t EventLoop::wait() {
+    if (!group_) {
+        delay(FALLBACK_POLL_MS);
+        has_deadline_ = false;
+        return POSTED_EVENTS | EVENT_TIMER;
+    }
+
+    TickType_t ticks = portMAX_DELAY;
+    if (has_deadline_) {
+        int32_t left = (int32_t)(deadline_ms_ - millis());
+        ticks = left > 0 ? pdMS_TO_TICKS(left) : 0;
+        has_deadline_ = false;
+    }
+    EventBits_t bits = xEventGroupWaitBits(group_, POSTED_EVENTS, pdTRUE, pdFALSE, ticks) & POSTED_EVENTS;
+    return bits ? bits : EVENT_TIMER;
+}
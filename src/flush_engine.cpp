@@ -0,0 +1,93 @@
+#include "flush_engine.h"
+#include <esp_heap_caps.h>
+
+bool FlushEngine::begin(Arduino_GFX* out, size_t tile_pixels) {
+    if (task_) return true;
+
+    out_         = out;
+    tile_pixels_ = tile_pixels;
+
+    for (auto& t : tiles_) {
+        t = (uint16_t*)heap_caps_malloc(tile_pixels_ * sizeof(uint16_t),
+                                        MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    }
+    pending_ = xQueueCreate(2, sizeof(Tile));
+    free_    = xQueueCreate(2, sizeof(uint16_t*));
+
+    if (!tiles_[0] || !tiles_[1] || !pending_ || !free_) {
+        Serial.println("[disp] flush buffers alloc failed");
+        end();
+        return false;
+    }
+    for (auto& t : tiles_) xQueueSend(free_, &t, 0);
+
+    if (xTaskCreatePinnedToCore(taskEntry, "lcd_flush", TASK_STACK, this,
+                                TASK_PRIORITY, &task_, TASK_CORE) != pdPASS) {
+        Serial.println("[disp] flush task create failed");
+        task_ = nullptr;
+        end();
+        return false;
+    }
+    return true;
+}
+
+void FlushEngine::end() {
+    if (task_) {
+        waitIdle();
+        vTaskDelete(task_);
+        task_ = nullptr;
+    }
+    if (pending_) { vQueueDelete(pending_); pending_ = nullptr; }
+    if (free_)    { vQueueDelete(free_);    free_    = nullptr; }
+    for (auto& t : tiles_) {
+        if (t) { heap_caps_free(t); t = nullptr; }
+    }
+}
+
+uint16_t* FlushEngine::acquireTile() {
+    uint16_t* tile = nullptr;
+    xQueueReceive(free_, &tile, portMAX_DELAY);
+    return tile;
+}
+
+void FlushEngine::submitTile(uint16_t* tile, int16_t x, int16_t y, int16_t w, int16_t h, bool last) {
+    Tile t = { tile, x, y, w, h, last };
+    xQueueSend(pending_, &t, portMAX_DELAY);
+}
+
+void FlushEngine::waitIdle() {
+    // Both tiles back in the free queue means nothing is queued or on the
+    // wire, and the last frame's callback has returned
+    uint16_t* a = nullptr;
+    uint16_t* b = nullptr;
+    xQueueReceive(free_, &a, portMAX_DELAY);
+    xQueueReceive(free_, &b, portMAX_DELAY);
+    xQueueSend(free_, &a, 0);
+    xQueueSend(free_, &b, 0);
+}
+
+void FlushEngine::onFrameDone(FlushDoneCallback cb, void* ctx) {
+    done_ctx_ = ctx;
+    done_cb_  = cb;
+}
+
+void FlushEngine::taskEntry(void* arg) {
+    static_cast<FlushEngine*>(arg)->run();
+}
+
+void FlushEngine::run() {
+    Tile t;
+    for (;;) {
+        if (xQueueReceive(pending_, &t, portMAX_DELAY) != pdTRUE) continue;
+
+        out_->draw16bitRGBBitmap(t.x, t.y, t.buf, t.w, t.h);
+
+        // Callback before the tile goes back: waitIdle() (and so end())
+        // must not return while it is still running
+        if (t.last) {
+            FlushDoneCallback cb = done_cb_;
+            if (cb) cb(done_ctx_);
+        }
+        xQueueSend(free_, &t.buf, portMAX_DELAY);
+    }
+}
@@ -0,0 +1,63 @@
+#include "gesture_classifier.h"
+
+GestureType GestureClassifier::feed(const TouchSample &s) {
+    if (s.data.count > 0) {
+        int16_t screen_x = s.data.points[0].x;
+        int16_t screen_y = s.data.points[0].y;
+        
+        if (!in_progress_) {
+            // Start tracking a new touch
+            in_progress_ = true;
+            start_x_ = screen_x;
+            start_y_ = screen_y;
+            last_x_ = screen_x;
+            last_y_ = screen_y;
+            start_us_ = s.time_us;
+        } else {
+            // Update last position during touch
+            last_x_ = screen_x;
+            last_y_ = screen_y;
+        }
+        
+        return GestureType::NONE;
+    } else {
+        // Touch released - determine gesture type
+        if (in_progress_) {
+            in_progress_ = false;
+            
+            int16_t delta_x = last_x_ - start_x_;
+            int16_t delta_y = last_y_ - start_y_;
+            uint32_t duration = (s.time_us - start_us_) / 1000;
+            
+            int16_t abs_delta_x = abs(delta_x);
+            int16_t abs_delta_y = abs(delta_y);
+            
+            // Check if it's a swipe (significant movement)
+            if (duration <= SWIPE_MAX_TIME) {
+                // Horizontal swipe (x movement > y movement)
+                if (abs_delta_x > abs_delta_y && abs_delta_x >= SWIPE_MIN_DISTANCE) {
+                    if (delta_x < 0) {
+                        return GestureType::SWIPE_RIGHT_TO_LEFT;
+                    } else {
+                        return GestureType::SWIPE_LEFT_TO_RIGHT;
+                    }
+                }
+                // Vertical swipe
+                else if (abs_delta_y >= SWIPE_MIN_DISTANCE) {
+                    if (delta_y < 0) {
+                        return GestureType::SWIPE_BOTTOM_TO_TOP;
+                    } else {
+                        return GestureType::SWIPE_TOP_TO_BOTTOM;
+                    }
+                }
+            }
+            
+            // If not a swipe, check if it's a tap (minimal movement)
+            if (abs_delta_x <= TAP_MAX_MOVEMENT && abs_delta_y <= TAP_MAX_MOVEMENT) {
+                return GestureType::TAP;
+            }
+        }
+        
+        return GestureType::NONE;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+#include "gesture_recognizer.h"
+
+static float span(const TouchData &d) {
+    float dx = (float)d.points[1].x - d.points[0].x;
+    float dy = (float)d.points[1].y - d.points[0].y;
+    return sqrtf(dx * dx + dy * dy);
+}
+
+static float angle(const TouchData &d) {
+    // Screen y grows downward; flip it so positive is counter-clockwise
+    return atan2f(-((float)d.points[1].y - d.points[0].y),
+                  (float)d.points[1].x - d.points[0].x);
+}
+
+static int32_t distSq(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    int32_t dx = x1 - x0;
+    int32_t dy = y1 - y0;
+    return dx * dx + dy * dy;
+}
+
+void GestureRecognizer::reset() {
+    state_ = State::IDLE;
+    have_tap_ = false;
+    history_count_ = 0;
+    event_count_ = 0;
+}
+
+bool GestureRecognizer::next(GestureEvent &e) {
+    if (event_count_ == 0) return false;
+    e = events_[event_head_];
+    event_head_ = (event_head_ + 1) % EVENT_LEN;
+    event_count_--;
+    return true;
+}
+
+GestureEvent *GestureRecognizer::pendingTail(GestureEventType type) {
+    if (event_count_ == 0) return nullptr;
+    GestureEvent &tail = events_[(event_head_ + event_count_ - 1) % EVENT_LEN];
+    return tail.type == type ? &tail : nullptr;
+}
+
+GestureEvent &GestureRecognizer::emit(GestureEventType type, uint32_t time_us, int16_t x, int16_t y) {
+    // Oldest event is overwritten if the consumer falls this far behind
+    if (event_count_ == EVENT_LEN) {
+        event_head_ = (event_head_ + 1) % EVENT_LEN;
+        event_count_--;
+    }
+    GestureEvent &e = events_[(event_head_ + event_count_) % EVENT_LEN];
+    event_count_++;
+    e = {};
+    e.type = type;
+    e.time_us = time_us;
+    e.x = x;
+    e.y = y;
+    e.scale = 1.0f;
+    return e;
+}
+
+void GestureRecognizer::feed(const TouchSample &s) {
+    if (s.data.count == 0) {
+        if (state_ != State::IDLE) onUp(s);
+        return;
+    }
+
+    int16_t x = s.data.points[0].x;
+    int16_t y = s.data.points[0].y;
+    history_[history_head_] = { s.time_us, x, y };
+    history_head_ = (history_head_ + 1) % HISTORY_LEN;
+    if (history_count_ < HISTORY_LEN) history_count_++;
+
+    if (state_ == State::IDLE) {
+        onDown(s);
+    } else if (s.data.count >= 2 && state_ != State::SPENT) {
+        onTwoFingers(s);
+    } else if (state_ == State::PINCHING) {
+        // Down to one finger: the pinch is over, the rest of this touch is ignored
+        GestureEvent &e = emit(GestureEventType::PINCH_END, s.time_us, x, y);
+        e.scale = pinch_scale_;
+        e.rotation = pinch_rotation_;
+        state_ = State::SPENT;
+    } else if (state_ != State::SPENT) {
+        onMove(s);
+    }
+    last_x_ = x;
+    last_y_ = y;
+}
+
+void GestureRecognizer::onDown(const TouchSample &s) {
+    state_ = State::PRESSED;
+    down_us_ = s.time_us;
+    down_x_ = drag_x_ = s.data.points[0].x;
+    down_y_ = drag_y_ = s.data.points[0].y;
+    long_press_sent_ = false;
+    history_[0] = { s.time_us, down_x_, down_y_ };
+    history_head_ = 1;
+    history_count_ = 1;
+    if (s.data.count >= 2) onTwoFingers(s);
+}
+
+void GestureRecognizer::onMove(const TouchSample &s) {
+    int16_t x = s.data.points[0].x;
+    int16_t y = s.data.points[0].y;
+
+    if (state_ == State::PRESSED) {
+        if (distSq(down_x_, down_y_, x, y) > (int32_t)TOUCH_SLOP * TOUCH_SLOP) {
+            state_ = State::DRAGGING;
+            GestureEvent &e = emit(GestureEventType::DRAG_START, s.time_us, x, y);
+            e.dx = x - down_x_;
+            e.dy = y - down_y_;
+            drag_x_ = x;
+            drag_y_ = y;
+        } else if (!long_press_sent_ && s.time_us - down_us_ >= LONG_PRESS_MS * 1000) {
+            long_press_sent_ = true;
+            emit(GestureEventType::LONG_PRESS, s.time_us, x, y);
+        }
+        return;
+    }
+
+    // DRAGGING
+    if (x != drag_x_ || y != drag_y_) {
+        GestureEvent *e = pendingTail(GestureEventType::DRAG);
+        if (e) {
+            e->time_us = s.time_us;
+            e->x = x;
+            e->y = y;
+        } else {
+            e = &emit(GestureEventType::DRAG, s.time_us, x, y);
+        }
+        e->dx += x - drag_x_;
+        e->dy += y - drag_y_;
+        drag_x_ = x;
+        drag_y_ = y;
+    }
+}
+
+void GestureRecognizer::onTwoFingers(const TouchSample &s) {
+    int16_t mx = (s.data.points[0].x + s.data.points[1].x) / 2;
+    int16_t my = (s.data.points[0].y + s.data.points[1].y) / 2;
+
+    if (state_ != State::PINCHING) {
+        if (state_ == State::DRAGGING) {
+            GestureEvent &e = emit(GestureEventType::DRAG_END, s.time_us, last_x_, last_y_);
+            e.dx = last_x_ - down_x_;
+            e.dy = last_y_ - down_y_;
+        }
+        state_ = State::PINCHING;
+        pinch_span_ = max(span(s.data), 1.0f);
+        pinch_angle_ = angle(s.data);
+        pinch_scale_ = 1.0f;
+        pinch_rotation_ = 0.0f;
+        emit(GestureEventType::PINCH_START, s.time_us, mx, my);
+        return;
+    }
+
+    float scale = span(s.data) / pinch_span_;
+    float rotation = angle(s.data) - pinch_angle_;
+    if (rotation > (float)M_PI)  rotation -= 2.0f * (float)M_PI;
+    if (rotation < -(float)M_PI) rotation += 2.0f * (float)M_PI;
+
+    if (fabsf(scale - pinch_scale_) >= PINCH_MIN_SCALE ||
+        fabsf(rotation - pinch_rotation_) >= PINCH_MIN_ROTATION) {
+        pinch_scale_ = scale;
+        pinch_rotation_ = rotation;
+        GestureEvent *e = pendingTail(GestureEventType::PINCH);
+        if (e) {
+            e->time_us = s.time_us;
+            e->x = mx;
+            e->y = my;
+        } else {
+            e = &emit(GestureEventType::PINCH, s.time_us, mx, my);
+        }
+        e->scale = scale;
+        e->rotation = rotation;
+    }
+}
+
+void GestureRecognizer::onUp(const TouchSample &s) {
+    switch (state_) {
+        case State::PRESSED: {
+            if (long_press_sent_ || s.time_us - down_us_ > TAP_MAX_MS * 1000) break;
+            emit(GestureEventType::TAP, s.time_us, down_x_, down_y_);
+            if (have_tap_ && s.time_us - tap_us_ <= DOUBLE_TAP_MS * 1000 &&
+                distSq(tap_x_, tap_y_, down_x_, down_y_) <= (int32_t)DOUBLE_TAP_SLOP * DOUBLE_TAP_SLOP) {
+                emit(GestureEventType::DOUBLE_TAP, s.time_us, down_x_, down_y_);
+                have_tap_ = false;   // a third tap starts over
+            } else {
+                have_tap_ = true;
+                tap_us_ = s.time_us;
+                tap_x_ = down_x_;
+                tap_y_ = down_y_;
+            }
+            break;
+        }
+        case State::DRAGGING: {
+            GestureEvent &end = emit(GestureEventType::DRAG_END, s.time_us, last_x_, last_y_);
+            end.dx = last_x_ - down_x_;
+            end.dy = last_y_ - down_y_;
+            float vx, vy;
+            releaseVelocity(vx, vy);
+            if (vx * vx + vy * vy >= FLING_MIN_VELOCITY * FLING_MIN_VELOCITY) {
+                GestureEvent &e = emit(GestureEventType::FLING, s.time_us, last_x_, last_y_);
+                e.vx = vx;
+                e.vy = vy;
+            }
+            break;
+        }
+        case State::PINCHING: {
+            GestureEvent &e = emit(GestureEventType::PINCH_END, s.time_us, last_x_, last_y_);
+            e.scale = pinch_scale_;
+            e.rotation = pinch_rotation_;
+            break;
+        }
+        default:
+            break;
+    }
+    if (state_ != State::PRESSED) have_tap_ = false;
+    state_ = State::IDLE;
+}
+
+void GestureRecognizer::releaseVelocity(float &vx, float &vy) const {
+    // Newest sample against the oldest one still inside the window
+    vx = vy = 0.0f;
+    if (history_count_ < 2) return;
+    const HistoryPoint &last = history_[(history_head_ + HISTORY_LEN - 1) % HISTORY_LEN];
+    const HistoryPoint *first = &last;
+    for (uint8_t i = 2; i <= history_count_; i++) {
+        const HistoryPoint &p = history_[(history_head_ + HISTORY_LEN - i) % HISTORY_LEN];
+        if (last.time_us - p.time_us > VELOCITY_WINDOW_MS * 1000) break;
+        first = &p;
+    }
+    uint32_t dt_us = last.time_us - first->time_us;
+    if (dt_us == 0) return;
+    vx = (last.x - first->x) * 1e6f / dt_us;
+    vy = (last.y - first->y) * 1e6f / dt_us;
+}
@@ -0,0 +1,280 @@
+#include "json_util.h"
+
+// What the tokenizer will accept next
+enum class Expect : uint8_t {
+    ROOT,           // the single top-level value
+    VALUE_OR_END,   // just inside '['
+    VALUE,          // after ',' in an array
+    KEY_OR_END,     // just inside '{'
+    KEY,            // after ',' in an object
+    COLON,
+    MEMBER_VALUE,   // after ':'
+    COMMA_OR_END,
+    DONE
+};
+
+static bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static bool isDelimiter(char c) {
+    return isSpace(c) || c == ',' || c == ']' || c == '}' || c == ':';
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static bool validPrimitive(const char* s, size_t len) {
+    if (len == 4 && memcmp(s, "true", 4) == 0)  return true;
+    if (len == 5 && memcmp(s, "false", 5) == 0) return true;
+    if (len == 4 && memcmp(s, "null", 4) == 0)  return true;
+    // Number: loose check, the callers only ever read these as text
+    if (s[0] != '-' && (s[0] < '0' || s[0] > '9')) return false;
+    for (size_t i = 1; i < len; i++) {
+        char c = s[i];
+        if (!((c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E' ||
+              c == '+' || c == '-'))
+            return false;
+    }
+    return true;
+}
+
+bool JsonDoc::parse(const char* json, size_t len) {
+    json_  = json;
+    count_ = 0;
+    if (!json || len > MAX_LEN) return false;
+    if (tokenize(json, len)) return true;
+    count_ = 0;   // a failed parse finds nothing
+    return false;
+}
+
+bool JsonDoc::tokenize(const char* json, size_t len) {
+
+    uint8_t stack[MAX_DEPTH];   // open containers, as token indices
+    uint8_t depth  = 0;
+    Expect  expect = Expect::ROOT;
+
+    auto add = [&](JsonType type, size_t start, size_t end) -> bool {
+        if (count_ == MAX_TOKENS) return false;
+        tokens_[count_++] = { type, (uint16_t)start, (uint16_t)end, 0 };
+        return true;
+    };
+    auto wantsValue = [&]() {
+        return expect == Expect::ROOT || expect == Expect::VALUE_OR_END ||
+               expect == Expect::VALUE || expect == Expect::MEMBER_VALUE;
+    };
+    // A value just finished: count it in its array and move on
+    auto valueDone = [&]() {
+        if (depth == 0) {
+            expect = Expect::DONE;
+            return;
+        }
+        JsonToken& parent = tokens_[stack[depth - 1]];
+        if (parent.type == JsonType::ARRAY) parent.size++;
+        expect = Expect::COMMA_OR_END;
+    };
+
+    for (size_t pos = 0; pos < len; pos++) {
+        char c = json[pos];
+        if (isSpace(c)) continue;
+        if (expect == Expect::DONE) return false;   // trailing garbage
+
+        switch (c) {
+        case '{':
+        case '[':
+            if (!wantsValue() || depth == MAX_DEPTH) return false;
+            if (!add(c == '{' ? JsonType::OBJECT : JsonType::ARRAY, pos, 0)) return false;
+            stack[depth++] = count_ - 1;
+            expect = c == '{' ? Expect::KEY_OR_END : Expect::VALUE_OR_END;
+            break;
+
+        case '}':
+        case ']': {
+            if (depth == 0) return false;
+            JsonToken& open = tokens_[stack[depth - 1]];
+            if (c == '}' && (open.type != JsonType::OBJECT ||
+                             (expect != Expect::KEY_OR_END && expect != Expect::COMMA_OR_END)))
+                return false;
+            if (c == ']' && (open.type != JsonType::ARRAY ||
+                             (expect != Expect::VALUE_OR_END && expect != Expect::COMMA_OR_END)))
+                return false;
+            open.end = (uint16_t)(pos + 1);
+            depth--;
+            valueDone();
+            break;
+        }
+
+        case '"': {
+            bool isKey = expect == Expect::KEY_OR_END || expect == Expect::KEY;
+            if (!isKey && !wantsValue()) return false;
+            size_t start = pos + 1;
+            for (pos = start; pos < len && json[pos] != '"'; pos++) {
+                unsigned char s = (unsigned char)json[pos];
+                if (s < 0x20) return false;
+                if (s != '\\') continue;
+                if (++pos >= len) return false;
+                switch (json[pos]) {
+                case '"': case '\\': case '/': case 'b':
+                case 'f': case 'n':  case 'r': case 't':
+                    break;
+                case 'u':
+                    if (pos + 4 >= len) return false;
+                    for (int k = 1; k <= 4; k++)
+                        if (hexValue(json[pos + k]) < 0) return false;
+                    pos += 4;
+                    break;
+                default:
+                    return false;
+                }
+            }
+            if (pos >= len) return false;   // unterminated
+            if (!add(JsonType::STRING, start, pos)) return false;
+            if (isKey) {
+                tokens_[stack[depth - 1]].size++;
+                expect = Expect::COLON;
+            } else {
+                valueDone();
+            }
+            break;
+        }
+
+        case ':':
+            if (expect != Expect::COLON) return false;
+            expect = Expect::MEMBER_VALUE;
+            break;
+
+        case ',':
+            if (expect != Expect::COMMA_OR_END) return false;
+            expect = tokens_[stack[depth - 1]].type == JsonType::OBJECT
+                   ? Expect::KEY : Expect::VALUE;
+            break;
+
+        default: {
+            if (!wantsValue()) return false;
+            size_t start = pos;
+            while (pos < len && !isDelimiter(json[pos])) pos++;
+            if (!validPrimitive(json + start, pos - start)) return false;
+            if (!add(JsonType::PRIMITIVE, start, pos)) return false;
+            pos--;   // the delimiter is handled next time round
+            valueDone();
+            break;
+        }
+        }
+    }
+    return expect == Expect::DONE;
+}
+
+JsonView JsonDoc::view(uint8_t i) const {
+    JsonView v;
+    v.data = json_ + tokens_[i].start;
+    v.len  = tokens_[i].end - tokens_[i].start;
+    v.type = tokens_[i].type;
+    return v;
+}
+
+JsonView JsonDoc::get(const char* key) const {
+    if (count_ == 0 || tokens_[0].type != JsonType::OBJECT) return JsonView();
+    uint16_t rootEnd = tokens_[0].end;
+    uint8_t  i       = 1;
+    while (i + 1 < count_ && tokens_[i].start < rootEnd) {
+        uint8_t value = i + 1;
+        if (view(i).equals(key)) return view(value);
+        // Skip the value and anything nested inside it
+        uint16_t valueEnd = tokens_[value].end;
+        i = value + 1;
+        while (i < count_ && tokens_[i].start < valueEnd) i++;
+    }
+    return JsonView();
+}
+
+bool JsonView::equals(const char* s) const {
+    if (!found()) return false;
+    size_t n = strlen(s);
+    return n == len && memcmp(data, s, n) == 0;
+}
+
+// Unescapes the next character at data[pos] into 'out' (up to 4 bytes of
+// UTF-8), advancing 'pos'. The tokenizer has already checked the escapes.
+static size_t nextChar(const char* data, size_t len, size_t& pos, char* out) {
+    char c = data[pos++];
+    if (c != '\\') {
+        out[0] = c;
+        return 1;
+    }
+    c = data[pos++];
+    switch (c) {
+    case 'b': out[0] = '\b'; return 1;
+    case 'f': out[0] = '\f'; return 1;
+    case 'n': out[0] = '\n'; return 1;
+    case 'r': out[0] = '\r'; return 1;
+    case 't': out[0] = '\t'; return 1;
+    case 'u': break;
+    default:  out[0] = c;    return 1;   // " \ /
+    }
+
+    uint32_t cp = 0;
+    for (int k = 0; k < 4; k++) cp = (cp << 4) | hexValue(data[pos++]);
+    // Surrogate pair
+    if (cp >= 0xD800 && cp < 0xDC00 && pos + 6 <= len &&
+        data[pos] == '\\' && data[pos + 1] == 'u') {
+        uint32_t lo = 0;
+        for (int k = 2; k < 6; k++) lo = (lo << 4) | hexValue(data[pos + k]);
+        if (lo >= 0xDC00 && lo < 0xE000) {
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+            pos += 6;
+        }
+    }
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+size_t JsonView::copyTo(char* dst, size_t cap) const {
+    size_t n       = 0;
+    size_t written = 0;   // stops growing at the first character that won't fit
+    size_t pos     = 0;
+    while (pos < len) {
+        char buf[4];
+        size_t k = nextChar(data, len, pos, buf);
+        if (written == n && n + k < cap) {
+            memcpy(dst + n, buf, k);
+            written += k;
+        }
+        n += k;
+    }
+    if (cap > 0) dst[written] = '\0';
+    return n;
+}
+
+String JsonView::toString() const {
+    String s;
+    s.reserve(len);   // unescaping only ever shrinks
+    size_t pos = 0;
+    while (pos < len) {
+        char buf[4];
+        size_t k = nextChar(data, len, pos, buf);
+        s.concat(buf, k);
+    }
+    return s;
+}
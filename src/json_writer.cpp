@@ -0,0 +1,106 @@
+#include "json_writer.h"
+
+void jsonStringSink(const char* data, size_t len, void* ctx) {
+    static_cast<String*>(ctx)->concat(data, len);
+}
+
+void JsonWriter::flush() {
+    if (len_ == 0) return;
+    sink_(buf_, len_, ctx_);
+    len_ = 0;
+}
+
+void JsonWriter::put(char c) {
+    if (len_ == BUF_LEN) flush();
+    buf_[len_++] = c;
+}
+
+void JsonWriter::raw(const char* s) {
+    while (*s) put(*s++);
+}
+
+// Comma before every value but the first at this level; none after a key
+void JsonWriter::separate() {
+    if (after_key_) {
+        after_key_ = false;
+        return;
+    }
+    uint16_t bit = 1u << depth_;
+    if (has_items_ & bit) put(',');
+    has_items_ |= bit;
+}
+
+void JsonWriter::open(char c) {
+    separate();
+    put(c);
+    if (depth_ + 1 < MAX_DEPTH) depth_++;
+    has_items_ &= ~(1u << depth_);
+}
+
+void JsonWriter::close(char c) {
+    if (depth_ > 0) depth_--;
+    put(c);
+}
+
+JsonWriter& JsonWriter::beginObject() { open('{');  return *this; }
+JsonWriter& JsonWriter::endObject()   { close('}'); return *this; }
+JsonWriter& JsonWriter::beginArray()  { open('[');  return *this; }
+JsonWriter& JsonWriter::endArray()    { close(']'); return *this; }
+
+JsonWriter& JsonWriter::key(const char* k) {
+    value(k);
+    put(':');
+    after_key_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(const char* s) {
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    separate();
+    put('"');
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        switch (c) {
+        case '"':  raw("\\\""); break;
+        case '\\': raw("\\\\"); break;
+        case '\n': raw("\\n");  break;
+        case '\r': raw("\\r");  break;
+        case '\t': raw("\\t");  break;
+        default:
+            if (c < 0x20) {
+                raw("\\u00");
+                put(HEX_DIGITS[c >> 4]);
+                put(HEX_DIGITS[c & 0xF]);
+            } else {
+                put((char)c);
+            }
+        }
+    }
+    put('"');
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(bool b) {
+    separate();
+    raw(b ? "true" : "false");
+    return *this;
+}
+
+JsonWriter& JsonWriter::number(unsigned long long magnitude, bool negative) {
+    char tmp[21];
+    size_t n = 0;
+    do {
+        tmp[n++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+    separate();
+    if (negative) put('-');
+    while (n) put(tmp[--n]);
+    return *this;
+}
+
+JsonWriter& JsonWriter::null() {
+    separate();
+    raw("null");
+    return *this;
+}
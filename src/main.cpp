@@ -15,6 +15,12 @@
 #include "hosted_updater.h"
 #include "provision_code.h"
 #include "mqtt/provision.h"
+#include "event_loop.h"
+#include "net_service.h"
+#include "boot_sequencer.h"
+#include "boot_profiler.h"
+#include <esp_pm.h>
+#include <esp_sleep.h>
 
 extern "C" {
     #include "esp32-hal-hosted.h"
@@ -26,25 +32,28 @@ AppState      appState;
 ResetButton   resetBtn;
 WiFiManager   wifiMgr;
 MqttProvision mqttProvision;
-
-static char last_onboarding_status[48] = {0};
+EventLoop     events;
+NetService    net;
+BootSequencer boot;
+#if defined(TOUCH_TRACE_SERIAL) || defined(TOUCH_TRACE_FILE)
+TouchRecorder touchTrace;
+#endif
 
 // Start the MQTT provisioning flow and switch to the onboarding screen.
+// Status lines come back from the network task (see loop()).
 static void startOnboarding() {
     String code = ProvisionCode::getOrCreate();
     display.showOnboardingScreen(code.c_str());
-    mqttProvision.begin(code.c_str());
-    last_onboarding_status[0] = '\0';
-    display.updateOnboardingStatus(mqttProvision.getStatusMessage());
-    strncpy(last_onboarding_status, mqttProvision.getStatusMessage(),
-            sizeof(last_onboarding_status) - 1);
-    last_onboarding_status[sizeof(last_onboarding_status) - 1] = '\0';
+    NetCommand cmd = { NetCommandType::START_PROVISIONING, {0} };
+    strncpy(cmd.code, code.c_str(), sizeof(cmd.code) - 1);
+    net.send(cmd);
     appState.setScreen(AppScreen::ONBOARDING);
 }
 
 // Wait for the ESP-Hosted SDIO link to the C6 coprocessor to come up.
 // The C6 needs time to boot after the P4 resets it via the RESET pin.
 static void waitForHostedLink(uint32_t timeout_ms = 8000) {
+    BootPhaseScope timed(BootPhase::HOSTED_LINK);
     uint32_t start = millis();
     while (!hostedIsInitialized() && (millis() - start) < timeout_ms) {
         delay(100);
@@ -58,6 +67,28 @@ static void waitForHostedLink(uint32_t timeout_ms = 8000) {
     }
 }
 
+// loop() spends most of its time blocked in events.wait(); let the idle task
+// scale the clock down meanwhile, and light-sleep between ticks when the
+// IDF config has tickless idle. TP_INT is a wake source so a touch isn't
+// held up; TouchHandler owns the pin's interrupt type, so it sets that up.
+// Drivers that can't run slow (EMAC, SDIO) hold their own PM locks.
+static void enableIdlePowerSaving() {
+#if CONFIG_PM_ENABLE
+    esp_pm_config_t pm = {};
+    pm.max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+    pm.min_freq_mhz = 40;
+#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+    pm.light_sleep_enable = true;
+    touch.enableWakeup();
+    esp_sleep_enable_gpio_wakeup();
+#endif
+    esp_err_t err = esp_pm_configure(&pm);
+    if (err != ESP_OK) Serial.printf("[init] pm: failed (0x%x)\n", err);
+#else
+    Serial.println("[init] pm: not enabled in this build");
+#endif
+}
+
 void setup() {
     Serial.begin(115200);
     Serial.printf("\nScoreScrape v%s\n\n", FIRMWARE_VERSION);
@@ -70,6 +101,7 @@ void setup() {
     // in their begin(), but that runs after the reset window.
     NvsManager::instance().registerNamespace("wifi");
     NvsManager::instance().registerNamespace("device");
+    NvsManager::instance().registerNamespace("boot");
 
     // Factory reset: hold BOOT button at power-on for 5 seconds.
     // This must happen before wifiMgr.begin() because ETH.begin() takes
@@ -78,32 +110,82 @@ void setup() {
     resetBtn.waitForHold();
     resetBtn.disable();
 
-    if (touch.begin()) Serial.println("[init] touch: ok");
-    else               Serial.println("[init] touch: FAILED");
+    events.begin();
 
-    // Mount LittleFS early so the C6 updater can access the firmware file.
-    if (!LittleFS.begin(true)) {
-        Serial.println("[init] fs: format + mount");
-        LittleFS.format();
-        LittleFS.begin();
-    }
+    // Bring-up runs as parallel steps (see boot_sequencer.h); only real
+    // dependencies wait on each other:
+    //
+    //   touch
+    //   fs ──────┬─────────────┐
+    //   radio ───┴── c6 ───────┼── network
+    //   eth ───────────────────┘
+    //
+    // ETH.begin() is safe from here: the reset window is over.
+    // WiFi and ETH both initialise the shared netif / event loop on first
+    // use, so do it once up front rather than racing.
+    Network.begin();
 
-    display.showBootScreen("Starting radio...");
+    boot.add("touch", [] {
+        if (touch.begin()) Serial.println("[init] touch: ok");
+        else               Serial.println("[init] touch: FAILED");
+    });
+    // Mount LittleFS early so the C6 updater can access the firmware file.
+    uint32_t fsStep = boot.add("fs", [] {
+        if (!LittleFS.begin(true)) {
+            Serial.println("[init] fs: format + mount");
+            LittleFS.format();
+            LittleFS.begin();
+        }
+    });
+    uint32_t ethStep = boot.add("eth", [] { wifiMgr.startEthernet(); });
     // Initialize the ESP-Hosted SDIO link to the C6 coprocessor.
     // We go straight to AP_STA mode and NEVER change it again — the hosted
     // link does not survive WiFi.mode() transitions on the ESP32-P4.
-    WiFi.mode(WIFI_AP_STA);
-    waitForHostedLink();
-
-    display.showBootScreen("Verifying radio firmware...");
+    uint32_t radioStep = boot.add("radio", [] {
+        boot.setStatus("Starting radio...");
+        WiFi.mode(WIFI_AP_STA);
+        waitForHostedLink();
+    });
     // If the hosted link is up, check if the C6 firmware needs updating.
     // This will reboot if an update is applied.
-    HostedUpdater::updateIfNeeded();
+    uint32_t c6Step = boot.add("c6", [] {
+        boot.setStatus("Verifying radio firmware...");
+        BootPhaseScope timed(BootPhase::C6_CHECK);
+        HostedUpdater::updateIfNeeded();
+    }, fsStep | radioStep);
+    boot.add("network", [] {
+        wifiMgr.begin([](const char* msg) { boot.setStatus(msg); });
+    }, fsStep | ethStep | c6Step, 8192);
+
+    boot.run([](uint32_t elapsed_ms, const char* status) {
+        static char shown[64] = {0};
+        if (strcmp(status, shown) != 0) {
+            strncpy(shown, status, sizeof(shown) - 1);
+            display.showBootScreen(shown);
+        }
+        display.animateBootScreen(elapsed_ms);
+    });
+    boot.report();
+
+    touch.onSample([](void* ctx) { static_cast<EventLoop*>(ctx)->post(EVENT_TOUCH); }, &events);
+
+    // Touch trace capture for host replay (see touch_recorder.h): build with
+    // -DTOUCH_TRACE_SERIAL, or -DTOUCH_TRACE_FILE=\"/touch.trace\" for LittleFS
+#if defined(TOUCH_TRACE_SERIAL)
+    touchTrace.begin(Serial);
+    touch.setRecorder(&touchTrace);
+#elif defined(TOUCH_TRACE_FILE)
+    if (touchTrace.begin(LittleFS, TOUCH_TRACE_FILE)) touch.setRecorder(&touchTrace);
+#endif
 
-    wifiMgr.begin([](const char* msg) { display.showBootScreen(msg); });
+    bool bridgeCached;
+    {
+        BootPhaseScope timed(BootPhase::MQTT_CACHE);
+        bridgeCached = MqttProvision::hasBridgeId();
+    }
 
     // Already provisioned from a previous boot — go straight to home.
-    if (wifiMgr.isConnected() && MqttProvision::hasBridgeId()) {
+    if (wifiMgr.isConnected() && bridgeCached) {
         Serial.printf("[init] bridge: %s (cached)\n", MqttProvision::getBridgeId().c_str());
         display.showHomeScreen();
         appState.setScreen(AppScreen::HOME);
@@ -113,30 +195,40 @@ void setup() {
         display.showConnectToNetworkScreen(wifiMgr.getPortalSSID());
         appState.setScreen(AppScreen::CONNECT_NETWORK);
     }
-    Serial.println("[init] ready\n");
-}
 
-void loop() {
-    if (wifiMgr.isPortalActive())
-        wifiMgr.handlePortal();
+    // Saved before the network task starts, which reads the history for
+    // /api/boot and the MQTT register message
+    BootProfiler::instance().commit();
 
-    // When transitioning from portal to connected, show onboarding and start MQTT
-    if (wifiMgr.isConnected() && appState.getScreen() == AppScreen::CONNECT_NETWORK) {
-        startOnboarding();
-    }
+    // From here on the portal and MQTT run on the network task
+    net.onStatus([](void* ctx) { static_cast<EventLoop*>(ctx)->post(EVENT_NET); }, &events);
+    if (!net.begin(wifiMgr, mqttProvision)) Serial.println("[init] net: FAILED");
 
-    if (appState.getScreen() == AppScreen::ONBOARDING) {
-        mqttProvision.loop();
-        const char* status = mqttProvision.getStatusMessage();
-        if (status[0] && strcmp(status, last_onboarding_status) != 0) {
-            display.updateOnboardingStatus(status);
-            strncpy(last_onboarding_status, status, sizeof(last_onboarding_status) - 1);
-            last_onboarding_status[sizeof(last_onboarding_status) - 1] = '\0';
-        }
-        if (mqttProvision.isProvisioned()) {
-            mqttProvision.stop();
-            display.showHomeScreen();
-            appState.setScreen(AppScreen::HOME);
+    enableIdlePowerSaving();
+    Serial.printf("[init] ready in %lu ms\n\n", millis());
+}
+
+// UI side, on core 1: each pass handles whatever is ready (every check
+// below is cheap), arms a deadline for anything that still needs one, then
+// sleeps until the next event or deadline
+void loop() {
+    NetStatus status;
+    while (net.poll(status)) {
+        switch (status.type) {
+        case NetStatusType::CONNECTED:
+            // Portal done (or ethernet came up under it): start MQTT
+            if (appState.getScreen() == AppScreen::CONNECT_NETWORK) startOnboarding();
+            break;
+        case NetStatusType::PROVISION_STATUS:
+            if (appState.getScreen() == AppScreen::ONBOARDING)
+                display.updateOnboardingStatus(status.text);
+            break;
+        case NetStatusType::PROVISIONED:
+            if (appState.getScreen() == AppScreen::ONBOARDING) {
+                display.showHomeScreen();
+                appState.setScreen(AppScreen::HOME);
+            }
+            break;
         }
     }
 
@@ -145,7 +237,15 @@ void loop() {
         appState.setScreen(AppScreen::HOME);
     }
 
-    if (appState.getScreen() == AppScreen::HOME) {
+    // Only HOME reads touch. Everywhere else the samples are thrown away as
+    // they come in, and so is anything left over from another screen when
+    // HOME comes back, so an old touch doesn't replay as a tap.
+    static AppScreen touchScreen = AppScreen::BOOT;
+    AppScreen screen = appState.getScreen();
+    if (screen != AppScreen::HOME || touchScreen != AppScreen::HOME) touch.discardInput();
+    touchScreen = screen;
+
+    if (screen == AppScreen::HOME) {
         GestureType gesture = touch.detectGesture();
 
         if (gesture == GestureType::SWIPE_RIGHT_TO_LEFT) {
@@ -160,5 +260,9 @@ void loop() {
         }
     }
 
-    delay(10);
+    if (appState.getScreen() == AppScreen::TAPPED) {
+        events.wakeIn(appState.msUntilRevert());
+    }
+
+    events.wait();
 }
@@ -1,29 +1,51 @@
 #include "mqtt/client.h"
 
-static MqttClient* s_client_for_cb = nullptr;
-
-void MqttClient::onMessage(char* topic, byte* payload, unsigned int length) {
-    if (s_client_for_cb && s_client_for_cb->callback_) {
-        char* buf = (char*)malloc(length + 1);
-        if (buf) {
-            memcpy(buf, payload, length);
-            buf[length] = '\0';
-            s_client_for_cb->callback_(topic, buf, length);
-            free(buf);
-        }
-    }
-}
+static_assert(MQTT_KEEP_SLOTS <= 8, "keep_used_ has a bit per slot");
 
 MqttClient::MqttClient() : mqtt_(tls_) {
     tls_.setInsecure();
     mqtt_.setServer(MQTT_BROKER, MQTT_PORT);
     mqtt_.setBufferSize(MQTT_BUFFER_SIZE);
+    // Captures only 'this', so it fits std::function's inline storage
+    mqtt_.setCallback([this](char* topic, uint8_t* payload, unsigned int length) {
+        dispatch(topic, payload, length);
+    });
 }
 
-void MqttClient::setCallback(MqttMessageCallback cb) {
-    callback_ = cb;
-    s_client_for_cb = this;
-    mqtt_.setCallback(callback_ ? onMessage : nullptr);
+void MqttClient::setCallback(MqttMessageCallback cb, void* ctx) {
+    callback_     = cb;
+    callback_ctx_ = ctx;
+}
+
+void MqttClient::dispatch(char* topic, uint8_t* payload, unsigned int length) {
+    MqttMessageCallback cb = callback_;
+    if (cb) cb(topic, (const char*)payload, length, callback_ctx_);
+}
+
+char* MqttClient::keep(const char* payload, unsigned int length) {
+    if (length >= MQTT_BUFFER_SIZE) return nullptr;
+    uint8_t used = keep_used_.load(std::memory_order_relaxed);
+    for (;;) {
+        uint8_t slot = 0;
+        while (slot < MQTT_KEEP_SLOTS && (used & (1u << slot))) slot++;
+        if (slot == MQTT_KEEP_SLOTS) return nullptr;
+        if (!keep_used_.compare_exchange_weak(used, used | (1u << slot),
+                                              std::memory_order_acquire))
+            continue;   // 'used' reloaded, look again
+        char* buf = keep_[slot];
+        memcpy(buf, payload, length);
+        buf[length] = '\0';
+        return buf;
+    }
+}
+
+void MqttClient::release(char* kept) {
+    for (uint8_t slot = 0; slot < MQTT_KEEP_SLOTS; slot++) {
+        if (kept == keep_[slot]) {
+            keep_used_.fetch_and(~(1u << slot), std::memory_order_release);
+            return;
+        }
+    }
 }
 
 bool MqttClient::connect(const char* client_id) { return mqtt_.connect(client_id); }
@@ -1,30 +1,12 @@
 #include "mqtt/provision.h"
 #include "nvs_manager.h"
-
-static MqttProvision* s_provision = nullptr;
+#include "json_util.h"
+#include "boot_profiler.h"
+#include "json_writer.h"
 
 static const char* NVS_NS     = "device";
 static const char* NVS_BRIDGE = "bridge_id";
 
-static String extractJson(const char* json, const char* key) {
-    String n = String("\"") + key + "\"";
-    int ki = String(json).indexOf(n);
-    if (ki < 0) return "";
-    int ci = String(json).indexOf(':', ki + n.length());
-    if (ci < 0) return "";
-    int vi = ci + 1;
-    String s = json;
-    while (vi < (int)s.length() && s[vi] == ' ') vi++;
-    if (vi >= (int)s.length()) return "";
-    if (s[vi] == '"') {
-        int end = s.indexOf('"', vi + 1);
-        return (end > vi) ? s.substring(vi + 1, end) : "";
-    }
-    int end = vi;
-    while (end < (int)s.length() && s[end] != ',' && s[end] != '}') end++;
-    return s.substring(vi, end);
-}
-
 static void setStatus(char* buf, size_t sz, const char* msg) {
     strncpy(buf, msg, sz - 1);
     buf[sz - 1] = '\0';
@@ -42,8 +24,9 @@ String MqttProvision::getBridgeId() {
 
 // -- Callbacks ----------------------------------------------------------------
 
-void MqttProvision::onMessage(const char* topic, const char* payload, unsigned int length) {
-    if (s_provision) s_provision->handleMessage(topic, payload, length);
+void MqttProvision::onMessage(const char* topic, const char* payload, unsigned int length,
+                              void* ctx) {
+    static_cast<MqttProvision*>(ctx)->handleMessage(topic, payload, length);
 }
 
 // -- Lifecycle ----------------------------------------------------------------
@@ -55,9 +38,9 @@ void MqttProvision::begin(const char* code) {
     state_ = MqttProvisionState::CONNECTING;
     error_msg_[0] = '\0';
     subscribed_ = published_ = false;
-    s_provision = this;
+    poll_delay_ms_ = 0;
     setStatus(status_msg_, sizeof(status_msg_), "Connecting...");
-    client_.setCallback(onMessage);
+    client_.setCallback(onMessage, this);
     Serial.printf("[mqtt] claim: %s\n", topic_.c_str());
 }
 
@@ -65,7 +48,7 @@ void MqttProvision::stop() {
     if (client_.isConnected()) {
         client_.disconnect();
     }
-    s_provision = nullptr;
+    client_.setCallback(nullptr, nullptr);
     state_ = MqttProvisionState::IDLE;
 }
 
@@ -76,17 +59,24 @@ void MqttProvision::loop() {
 
     if (!client_.isConnected()) {
         subscribed_ = false;
-        if (millis() - last_connect_attempt_ >= connect_interval_ms_) {
+        uint32_t since = millis() - last_connect_attempt_;
+        if (since >= connect_interval_ms_) {
             last_connect_attempt_ = millis();
             doConnect();
+            // Straight on to subscribing if that worked
+            poll_delay_ms_ = client_.isConnected() ? 0 : connect_interval_ms_;
+        } else {
+            poll_delay_ms_ = connect_interval_ms_ - since;
         }
         return;
     }
 
     client_.loop();
+    poll_delay_ms_ = POLL_MS;
 
     if (!subscribed_) {
         doSubscribe();
+        if (subscribed_) poll_delay_ms_ = 0;
         return;
     }
 
@@ -118,7 +108,15 @@ void MqttProvision::doSubscribe() {
 }
 
 void MqttProvision::doPublish() {
-    String payload = "{\"type\":\"register\",\"firmware_version\":\"" FIRMWARE_VERSION "\"}";
+    // Boot-time percentiles ride along so the fleet view can aggregate them
+    String payload;
+    payload.reserve(224);
+    {
+        JsonWriter w(jsonStringSink, &payload);
+        w.beginObject().field("type", "register").field("firmware_version", FIRMWARE_VERSION);
+        BootProfiler::instance().toJson(w.key("boot"), false);
+        w.endObject();
+    }
     if (client_.publish(topic_.c_str(), payload.c_str())) {
         published_ = true;
         Serial.println("[mqtt] registered");
@@ -129,20 +127,27 @@ void MqttProvision::doPublish() {
 
 void MqttProvision::handleMessage(const char* topic, const char* payload, unsigned int length) {
     (void)topic;
-    (void)length;
 
-    String type = extractJson(payload, "type");
+    // One pass over the payload; the lookups below only walk its tokens
+    JsonDoc doc;
+    if (!doc.parse(payload, length)) {
+        Serial.println("[mqtt] malformed message");
+        return;
+    }
+    JsonView type = doc.get("type");
 
-    if (type == "register") return;
+    if (type.equals("register")) return;
 
-    if (type == "provision") {
-        String bridgeId = extractJson(payload, "bridge_id");
-        if (bridgeId.length() > 0) {
+    if (type.equals("provision")) {
+        char bridgeId[64];
+        JsonView id = doc.get("bridge_id");
+        size_t len = id.copyTo(bridgeId, sizeof(bridgeId));
+        if (id.type == JsonType::STRING && len > 0 && len < sizeof(bridgeId)) {
             NvsManager::instance().registerNamespace(NVS_NS);
             if (NvsManager::instance().putString(NVS_NS, NVS_BRIDGE, bridgeId)) {
                 state_ = MqttProvisionState::PROVISIONED;
                 setStatus(status_msg_, sizeof(status_msg_), "Provisioned!");
-                Serial.printf("[mqtt] bridge: %s\n", bridgeId.c_str());
+                Serial.printf("[mqtt] bridge: %s\n", bridgeId);
             } else {
                 Serial.println("[mqtt] failed to save bridge_id");
             }
@@ -152,7 +157,7 @@ void MqttProvision::handleMessage(const char* topic, const char* payload, unsign
         return;
     }
 
-    if (type == "ack" && extractJson(payload, "status") == "registered") {
+    if (type.equals("ack") && doc.get("status").equals("registered")) {
         state_ = MqttProvisionState::REGISTERED;
         setStatus(status_msg_, sizeof(status_msg_), "Waiting for adoption...");
         Serial.println("[mqtt] waiting for adoption");
@@ -0,0 +1,106 @@
+#include "net_service.h"
+
+static NetService* s_service = nullptr;
+
+bool NetService::begin(WiFiManager& wifi, MqttProvision& provision) {
+    wifi_ = &wifi;
+    provision_ = &provision;
+    s_service = this;
+    if (xTaskCreatePinnedToCore(taskEntry, "net", TASK_STACK, this,
+                                TASK_PRIORITY, &task_, TASK_CORE) != pdPASS) {
+        Serial.println("[net]  task create failed");
+        task_ = nullptr;
+        return false;
+    }
+    // Link and IP changes wake the task so it notices without polling
+    Network.onEvent([](arduino_event_id_t) {
+        if (s_service && s_service->task_) xTaskNotifyGive(s_service->task_);
+    });
+    return true;
+}
+
+bool NetService::send(const NetCommand& cmd) {
+    if (!commands_.push(cmd)) return false;
+    if (task_) xTaskNotifyGive(task_);
+    return true;
+}
+
+bool NetService::poll(NetStatus& status) {
+    return status_.pop(status);
+}
+
+void NetService::onStatus(NetStatusCallback cb, void* ctx) {
+    status_ctx_ = ctx;
+    status_cb_  = cb;
+}
+
+void NetService::pushStatus(NetStatusType type, const char* text) {
+    NetStatus s;
+    s.type = type;
+    strncpy(s.text, text, sizeof(s.text) - 1);
+    s.text[sizeof(s.text) - 1] = '\0';
+    if (!status_.push(s)) {
+        Serial.println("[net]  status queue full");
+        return;
+    }
+    NetStatusCallback cb = status_cb_;
+    if (cb) cb(status_ctx_);
+}
+
+void NetService::taskEntry(void* arg) {
+    static_cast<NetService*>(arg)->run();
+}
+
+void NetService::handleCommand(const NetCommand& cmd) {
+    switch (cmd.type) {
+    case NetCommandType::START_PROVISIONING:
+        provision_->begin(cmd.code);
+        provisioning_ = true;
+        last_status_[0] = '\0';
+        break;
+    }
+}
+
+void NetService::run() {
+    bool connected = false;
+    for (;;) {
+        NetCommand cmd;
+        while (commands_.pop(cmd)) handleCommand(cmd);
+
+        TickType_t wait = portMAX_DELAY;
+
+        wifi_->handleLease();
+        if (wifi_->isRenewingLease()) wait = pdMS_TO_TICKS(WiFiManager::LEASE_POLL_MS);
+
+        if (wifi_->isPortalActive()) {
+            wifi_->handlePortal();
+            wait = pdMS_TO_TICKS(WiFiManager::PORTAL_POLL_MS);
+        }
+
+        bool now_connected = wifi_->isConnected();
+        if (now_connected && !connected) pushStatus(NetStatusType::CONNECTED);
+        connected = now_connected;
+
+        // MQTT waits out a lease renewal rather than connect on an address
+        // that is about to go
+        if (provisioning_ && !wifi_->isRenewingLease()) {
+            provision_->loop();
+            const char* status = provision_->getStatusMessage();
+            if (status[0] && strcmp(status, last_status_) != 0) {
+                strncpy(last_status_, status, sizeof(last_status_) - 1);
+                last_status_[sizeof(last_status_) - 1] = '\0';
+                pushStatus(NetStatusType::PROVISION_STATUS, status);
+            }
+            if (provision_->isProvisioned()) {
+                provision_->stop();
+                provisioning_ = false;
+                pushStatus(NetStatusType::PROVISIONED);
+            } else {
+                wait = min(wait, pdMS_TO_TICKS(provision_->pollDelayMs()));
+            }
+        }
+
+        // Commands and network events cut the wait short
+        ulTaskNotifyTake(pdTRUE, wait);
+    }
+}
@@ -83,6 +83,25 @@ bool NvsManager::putBool(const char* ns, const char* key, bool value) {
     return ok;
 }
 
+// --- Blob ---
+size_t NvsManager::getBlob(const char* ns, const char* key, void* buf, size_t maxLen) {
+    Preferences prefs;
+    prefs.begin(ns, true);
+    size_t len = prefs.isKey(key) ? prefs.getBytesLength(key) : 0;
+    if (len > maxLen) len = 0;
+    if (len > 0) len = prefs.getBytes(key, buf, maxLen);
+    prefs.end();
+    return len;
+}
+
+bool NvsManager::putBlob(const char* ns, const char* key, const void* data, size_t len) {
+    Preferences prefs;
+    prefs.begin(ns, false);
+    bool ok = prefs.putBytes(key, data, len) == len;
+    prefs.end();
+    return ok;
+}
+
 // --- Remove / Clear ---
 bool NvsManager::remove(const char* ns, const char* key) {
     Preferences prefs;
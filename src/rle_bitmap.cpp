@@ -0,0 +1,32 @@
+#include "rle_bitmap.h"
+
+const uint16_t* rleDecodeRow(const uint16_t* src, int16_t width,
+                             int16_t from, int16_t count, uint16_t* dst) {
+    int16_t col = 0;
+    int16_t end = from + count;
+
+    while (col < width) {
+        uint16_t ctrl = *src++;
+        int16_t n = (ctrl & 0x7FFF) + 1;
+        bool run = ctrl & 0x8000;
+
+        // Overlap of this packet with the wanted columns
+        int16_t lo = max<int16_t>(col, from);
+        int16_t hi = min<int16_t>(col + n, end);
+
+        if (run) {
+            if (dst) {
+                uint16_t color = *src;
+                for (int16_t i = lo; i < hi; i++) dst[i - from] = color;
+            }
+            src++;
+        } else {
+            if (dst) {
+                for (int16_t i = lo; i < hi; i++) dst[i - from] = src[i - col];
+            }
+            src += n;
+        }
+        col += n;
+    }
+    return src;
+}
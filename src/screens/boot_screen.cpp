@@ -8,17 +8,23 @@
 #define BOOT_STATUS_Y    ((SCREEN_H - LOGO_HEIGHT) / 2 + LOGO_HEIGHT + 10)
 #define BOOT_STATUS_H    40
 
-void drawBootScreen(DisplayContext& dc, Arduino_GFX* gfx, const char* status) {
-    static bool logo_drawn = false;
+// Indeterminate progress bar along the bottom edge
+#define BOOT_BAR_W       200
+#define BOOT_BAR_H       3
+#define BOOT_BAR_X       ((SCREEN_W - BOOT_BAR_W) / 2)
+#define BOOT_BAR_Y       (SCREEN_H - 10)
+#define BOOT_BAR_SEG_W   50
+#define BOOT_BAR_PERIOD  1200   // ms for one sweep there and back
 
-    gfx->startWrite();
+void drawBootScreen(DisplayContext& dc, const char* status) {
+    static bool logo_drawn = false;
 
     if (!logo_drawn) {
         dc.setColor(COLOR_WHITE, COLOR_BLACK);
         dc.clear();
         int16_t logo_x = (SCREEN_W - LOGO_WIDTH) / 2;
         int16_t logo_y = (SCREEN_H - LOGO_HEIGHT) / 2;
-        gfx->draw16bitRGBBitmap(logo_x, logo_y, (uint16_t*)logo_bitmap, LOGO_WIDTH, LOGO_HEIGHT);
+        dc.drawBitmap(logo_x, logo_y, logo_bitmap);
         logo_drawn = true;
     }
 
@@ -93,5 +99,19 @@ void drawBootScreen(DisplayContext& dc, Arduino_GFX* gfx, const char* status) {
         }
     }
 
-    gfx->endWrite();
+    dc.swapBuffers();
+}
+
+void drawBootProgress(DisplayContext& dc, uint32_t elapsed_ms) {
+    // Segment sweeps end to end and back (triangle wave)
+    uint32_t phase = elapsed_ms % BOOT_BAR_PERIOD;
+    uint32_t half = BOOT_BAR_PERIOD / 2;
+    uint32_t pos = phase < half ? phase : BOOT_BAR_PERIOD - phase;
+    int16_t seg_x = BOOT_BAR_X + (int16_t)(pos * (BOOT_BAR_W - BOOT_BAR_SEG_W) / half);
+
+    dc.setColor(COLOR_DARK_GRAY, COLOR_BLACK);
+    dc.fillRectangle(BOOT_BAR_X, BOOT_BAR_Y, BOOT_BAR_W, BOOT_BAR_H);
+    dc.setColor(COLOR_BRAND, COLOR_BLACK);
+    dc.fillRectangle(seg_x, BOOT_BAR_Y, BOOT_BAR_SEG_W, BOOT_BAR_H);
+    dc.swapBuffers();
 }
@@ -1,16 +1,21 @@
 #include "screens/connect_to_network_screen.h"
 #include "display_context.h"
 #include "display_config.h"
+#include "font_metrics.h"
 #include "colors.h"
 
-void drawConnectToNetworkScreen(DisplayContext& dc, Arduino_GFX* gfx, const char* apSsid) {
-    gfx->startWrite();
+static constexpr DisplayContext::StaticText TITLE    = staticText<DisplayContext::FONT_SMALL>("Connect to a Network");
+static constexpr DisplayContext::StaticText WIFI     = staticText<DisplayContext::FONT_SMALL>("WiFi Setup");
+static constexpr DisplayContext::StaticText OR       = staticText<DisplayContext::FONT_SMALL>("OR");
+static constexpr DisplayContext::StaticText ETHERNET = staticText<DisplayContext::FONT_SMALL>("Ethernet");
+static constexpr DisplayContext::StaticText PLUG_IN  = staticText<DisplayContext::FONT_SMALL>("Plug in cable");
 
+void drawConnectToNetworkScreen(DisplayContext& dc, const char* apSsid) {
     dc.setColor(COLOR_BLACK, COLOR_BLACK);
     dc.clear();
 
     dc.setColor(COLOR_WHITE, COLOR_BLACK);
-    dc.drawText(SCREEN_W / 2, 14, DisplayContext::FONT_SMALL, "Connect to a Network",
+    dc.drawText(SCREEN_W / 2, 14, TITLE,
         DisplayContext::TEXT_JUSTIFY_CENTER | DisplayContext::TEXT_JUSTIFY_VCENTER);
 
     dc.setColor(COLOR_DARK_GRAY, COLOR_BLACK);
@@ -36,7 +41,7 @@ void drawConnectToNetworkScreen(DisplayContext& dc, Arduino_GFX* gfx, const char
     dc.drawCircle(WIFI_CX, WIFI_CY, 13);
 
     dc.setColor(COLOR_WHITE, COLOR_BLACK);
-    dc.drawText(TEXT_X, ROW1_Y + LABEL_Y_OFF, DisplayContext::FONT_SMALL, "WiFi Setup",
+    dc.drawText(TEXT_X, ROW1_Y + LABEL_Y_OFF, WIFI,
         DisplayContext::TEXT_JUSTIFY_LEFT | DisplayContext::TEXT_JUSTIFY_TOP);
     dc.setColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
     dc.drawText(TEXT_X, ROW1_Y + DESC_Y_OFF, DisplayContext::FONT_SMALL, apSsid ? apSsid : "",
@@ -44,7 +49,7 @@ void drawConnectToNetworkScreen(DisplayContext& dc, Arduino_GFX* gfx, const char
 
     const int OR_Y = ROW1_Y + ROW_H + GAP_ABOVE_OR;
     dc.setColor(COLOR_WHITE, COLOR_BLACK);
-    dc.drawText(SCREEN_W / 2, OR_Y, DisplayContext::FONT_SMALL, "OR",
+    dc.drawText(SCREEN_W / 2, OR_Y, OR,
         DisplayContext::TEXT_JUSTIFY_CENTER | DisplayContext::TEXT_JUSTIFY_VCENTER);
 
     const int ROW2_Y = OR_Y + GAP_BELOW_OR;
@@ -54,11 +59,11 @@ void drawConnectToNetworkScreen(DisplayContext& dc, Arduino_GFX* gfx, const char
     dc.fillRectangle(ICON_X + ICON_SZ - 6, ROW2_Y + 4, 6, 10);
 
     dc.setColor(COLOR_WHITE, COLOR_BLACK);
-    dc.drawText(TEXT_X, ROW2_Y + LABEL_Y_OFF, DisplayContext::FONT_SMALL, "Ethernet",
+    dc.drawText(TEXT_X, ROW2_Y + LABEL_Y_OFF, ETHERNET,
         DisplayContext::TEXT_JUSTIFY_LEFT | DisplayContext::TEXT_JUSTIFY_TOP);
     dc.setColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
-    dc.drawText(TEXT_X, ROW2_Y + DESC_Y_OFF, DisplayContext::FONT_SMALL, "Plug in cable",
+    dc.drawText(TEXT_X, ROW2_Y + DESC_Y_OFF, PLUG_IN,
         DisplayContext::TEXT_JUSTIFY_LEFT | DisplayContext::TEXT_JUSTIFY_TOP);
 
-    gfx->endWrite();
+    dc.swapBuffers();
 }
@@ -1,19 +1,20 @@
 #include "screens/home_screen.h"
 #include "display_context.h"
 #include "display_config.h"
+#include "font_metrics.h"
 #include "colors.h"
 #include "assets/icon_bitmap.h"
 
-void drawHomeScreen(DisplayContext& dc, Arduino_GFX* gfx) {
-    gfx->startWrite();
+static constexpr DisplayContext::StaticText PLACEHOLDER = staticText<DisplayContext::FONT_LARGE>("testing");
 
+void drawHomeScreen(DisplayContext& dc) {
     dc.setColor(COLOR_WHITE, COLOR_BLACK);
     dc.clear();
 
-    gfx->draw16bitRGBBitmap(8, 8, (uint16_t*)icon_bitmap, ICON_WIDTH, ICON_HEIGHT);
+    dc.drawBitmap(8, 8, icon_bitmap);
 
-    dc.drawText(dc.getWidth() / 2, dc.getHeight() / 2, DisplayContext::FONT_LARGE, "testing",
+    dc.drawText(dc.getWidth() / 2, dc.getHeight() / 2, PLACEHOLDER,
         DisplayContext::TEXT_JUSTIFY_CENTER | DisplayContext::TEXT_JUSTIFY_VCENTER);
 
-    gfx->endWrite();
+    dc.swapBuffers();
 }
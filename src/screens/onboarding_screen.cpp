@@ -1,37 +1,42 @@
 #include "screens/onboarding_screen.h"
 #include "display_context.h"
 #include "display_config.h"
+#include "font_metrics.h"
 #include "colors.h"
 
 #define ONBOARDING_STATUS_H 24
 
-void drawOnboardingScreen(DisplayContext& dc, Arduino_GFX* gfx, const char* code) {
-    gfx->startWrite();
+static constexpr DisplayContext::StaticText DASHBOARD_URL =
+    staticText<DisplayContext::FONT_SMALL>("scorescrape.io/dashboard");
 
+void drawOnboardingScreen(DisplayContext& dc, const char* code) {
     dc.setColor(COLOR_BLACK, COLOR_BLACK);
     dc.clear();
 
     dc.setColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
-    dc.drawText(dc.getWidth() / 2, 24, DisplayContext::FONT_SMALL, "scorescrape.io/dashboard",
+    dc.drawText(dc.getWidth() / 2, 24, DASHBOARD_URL,
         DisplayContext::TEXT_JUSTIFY_CENTER | DisplayContext::TEXT_JUSTIFY_VCENTER);
 
     dc.setColor(COLOR_BRAND, COLOR_BLACK);
     dc.drawText(dc.getWidth() / 2, dc.getHeight() / 2, DisplayContext::FONT_XLARGE, code,
         DisplayContext::TEXT_JUSTIFY_CENTER | DisplayContext::TEXT_JUSTIFY_VCENTER);
 
-    gfx->endWrite();
+    dc.swapBuffers();
 }
 
-void drawOnboardingStatus(Arduino_Canvas* canvas, const char* msg) {
-    if (!canvas || !msg) return;
+void drawOnboardingStatus(DisplayContext& dc, const char* msg) {
+    if (!msg) return;
 
-    DisplayContext dc_status(canvas);
-    dc_status.setColor(COLOR_BLACK, COLOR_BLACK);
-    dc_status.fillRectangle(0, 0, SCREEN_W, ONBOARDING_STATUS_H);
+    const int16_t stripY = SCREEN_H - ONBOARDING_STATUS_H;
+    dc.setClip(0, stripY, SCREEN_W, ONBOARDING_STATUS_H);
 
-    dc_status.setColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
-    dc_status.drawText(SCREEN_W / 2, ONBOARDING_STATUS_H / 2, DisplayContext::FONT_SMALL, msg,
+    dc.setColor(COLOR_BLACK, COLOR_BLACK);
+    dc.clear();
+
+    dc.setColor(COLOR_LIGHT_GRAY, COLOR_BLACK);
+    dc.drawText(SCREEN_W / 2, stripY + ONBOARDING_STATUS_H / 2, DisplayContext::FONT_SMALL, msg,
         DisplayContext::TEXT_JUSTIFY_CENTER | DisplayContext::TEXT_JUSTIFY_VCENTER);
 
-    canvas->flush();
+    dc.clearClip();
+    dc.swapBuffers();
 }
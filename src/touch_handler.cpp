@@ -1,29 +1,179 @@
 #include "touch_handler.h"
 #include "board_config.h"
+#include <driver/gpio.h>
 
 TouchHandler::TouchHandler() 
     : touch(Wire, PIN_TP_RST, PIN_TP_INT), 
       last_touch_state(false),
-      touch_in_progress(false),
-      touch_start_x(0),
-      touch_start_y(0),
-      touch_last_x(0),
-      touch_last_y(0),
-      touch_start_time(0) {
+      task_handle(nullptr),
+      irq_time_us(0),
+      dropped_samples(0),
+      seen_dropped(0),
+      last_data(),
+      filtered_count(0),
+      last_sample_us(0),
+      prediction_lead_ms(DEFAULT_PREDICTION_MS),
+      motion_seq(0),
+      motion(),
+      recognizer(),
+      pending_gesture(GestureType::NONE),
+      recorder(nullptr),
+      sample_cb(nullptr),
+      sample_ctx(nullptr) {
+    for (auto& point : filters) {
+        for (auto& axis : point) axis.configure(FILTER_MIN_CUTOFF, FILTER_BETA, FILTER_D_CUTOFF);
+    }
 }
 
 bool TouchHandler::begin() {
     Wire.begin(PIN_TP_SDA, PIN_TP_SCL, 400000);
-    return touch.begin();
+    if (!touch.begin()) return false;
+
+    // The ISR needs the task handle, so the task comes first
+    if (xTaskCreatePinnedToCore(taskEntry, "touch", TASK_STACK, this,
+                                TASK_PRIORITY, &task_handle, TASK_CORE) != pdPASS) {
+        Serial.println("[init] touch: task create failed, polling");
+        task_handle = nullptr;
+        return true;
+    }
+    attachInterruptArg(digitalPinToInterrupt(PIN_TP_INT), onTouchInterrupt, this, ONLOW);
+    return true;
+}
+
+void TouchHandler::enableWakeup() {
+    // Same type as the interrupt; gpio_wakeup_enable() sets both
+    gpio_wakeup_enable((gpio_num_t)PIN_TP_INT, GPIO_INTR_LOW_LEVEL);
 }
 
 bool TouchHandler::isTouched() {
-    TouchData td;
-    return touch.read(td);
+    return last_data.count > 0;
 }
 
 void TouchHandler::getTouchData(TouchData &td) {
-    touch.read(td);
+    td = last_data;
+}
+
+bool TouchHandler::readSample(TouchSample &s) {
+    if (!samples.pop(s)) return false;
+    last_data = s.data;
+    if (recorder) recorder->record(s);
+    return true;
+}
+
+void TouchHandler::onSample(TouchSampleCallback cb, void *ctx) {
+    sample_cb = nullptr;
+    sample_ctx = ctx;
+    sample_cb = cb;
+}
+
+bool TouchHandler::readMotion(TouchMotion &m) const {
+    for (;;) {
+        uint32_t seq = motion_seq.load(std::memory_order_acquire);
+        if (seq == 0) return false;
+        if (seq & 1) continue;   // mid-update
+        m = motion;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (motion_seq.load(std::memory_order_relaxed) == seq) return true;
+    }
+}
+
+// -- Producer side (touch task, or loop() when polling) ------------------------
+
+void IRAM_ATTR TouchHandler::onTouchInterrupt(void* arg) {
+    TouchHandler* self = static_cast<TouchHandler*>(arg);
+    // Level triggered: off until the task is idle again (see run())
+    gpio_intr_disable((gpio_num_t)PIN_TP_INT);
+    self->irq_time_us = micros();
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->task_handle, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+void TouchHandler::taskEntry(void* arg) {
+    static_cast<TouchHandler*>(arg)->run();
+}
+
+void TouchHandler::run() {
+    bool down = false;
+    TickType_t last_wake = 0;
+    for (;;) {
+        uint32_t time_us;
+        if (!down) {
+            // Idle: re-arm TP_INT and sleep until it fires. If the line is
+            // still low it fires straight away, and the read below sorts
+            // out whether a finger is there.
+            gpio_intr_enable((gpio_num_t)PIN_TP_INT);
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            time_us = irq_time_us;
+            last_wake = xTaskGetTickCount();
+        } else {
+            // Finger down: fixed-rate sampling, TP_INT stays off
+            vTaskDelayUntil(&last_wake, SAMPLE_TICKS);
+            ulTaskNotifyTake(pdTRUE, 0);
+            time_us = micros();
+        }
+
+        // A failed read says nothing about the finger: skip it and keep
+        // sampling (or sleeping) as before, rather than reporting a lift
+        TouchData td;
+        if (!touch.read(td)) continue;
+        if (td.count == 0 && !down) continue;   // stray edge
+        publish(td, time_us);
+        down = td.count > 0;
+    }
+}
+
+void TouchHandler::pollSample() {
+    TouchData td;
+    if (!touch.read(td)) return;
+    if (td.count == 0 && !last_touch_state) return;
+    publish(td, micros());
+    last_touch_state = td.count > 0;
+}
+
+void TouchHandler::publish(const TouchData &td, uint32_t time_us) {
+    TouchSample s;
+    s.time_us = time_us;
+    s.data.count = td.count;
+    for (uint8_t i = 0; i < td.count; i++) {
+        int16_t x, y;
+        transformCoordinates(td.points[i].x, td.points[i].y, x, y);
+        s.data.points[i].x = x;
+        s.data.points[i].y = y;
+    }
+    if (!samples.push(s)) dropped_samples = dropped_samples + 1;
+    updateMotion(s);
+
+    TouchSampleCallback cb = sample_cb;
+    if (cb) cb(sample_ctx);
+}
+
+void TouchHandler::updateMotion(const TouchSample &s) {
+    // A new finger (or a different number of them) starts from scratch
+    if (s.data.count != filtered_count) {
+        for (auto& point : filters) {
+            for (auto& axis : point) axis.reset();
+        }
+        filtered_count = s.data.count;
+    }
+    float dt = (s.time_us - last_sample_us) * 1e-6f;
+    last_sample_us = s.time_us;
+    float lead = prediction_lead_ms * 1e-3f;
+
+    motion_seq.fetch_add(1, std::memory_order_relaxed);   // odd: writing
+    std::atomic_thread_fence(std::memory_order_release);
+    motion.time_us = s.time_us;
+    motion.count = s.data.count;
+    for (uint8_t i = 0; i < s.data.count; i++) {
+        TouchMotion::Point& p = motion.points[i];
+        p.x  = filters[i][0].filter(s.data.points[i].x, dt);
+        p.y  = filters[i][1].filter(s.data.points[i].y, dt);
+        p.vx = filters[i][0].velocity();
+        p.vy = filters[i][1].velocity();
+        p.predicted_x = p.x + p.vx * lead;
+        p.predicted_y = p.y + p.vy * lead;
+    }
+    motion_seq.fetch_add(1, std::memory_order_release);   // even: stable
 }
 
 void TouchHandler::transformCoordinates(int16_t touch_x, int16_t touch_y, int16_t &screen_x, int16_t &screen_y) {
@@ -35,71 +185,46 @@ void TouchHandler::transformCoordinates(int16_t touch_x, int16_t touch_y, int16_
     screen_y = 172 - touch_x;
 }
 
-GestureType TouchHandler::detectGesture() {
-    TouchData td;
-    bool is_touched = touch.read(td);
-    
-    if (is_touched && td.count > 0) {
-        int16_t touch_x = td.points[0].x;
-        int16_t touch_y = td.points[0].y;
-        
-        // Transform to screen coordinates
-        int16_t screen_x, screen_y;
-        transformCoordinates(touch_x, touch_y, screen_x, screen_y);
-        
-        if (!touch_in_progress) {
-            // Start tracking a new touch
-            touch_in_progress = true;
-            touch_start_x = screen_x;
-            touch_start_y = screen_y;
-            touch_last_x = screen_x;
-            touch_last_y = screen_y;
-            touch_start_time = millis();
-        } else {
-            // Update last position during touch
-            touch_last_x = screen_x;
-            touch_last_y = screen_y;
-        }
-        
-        return GestureType::NONE;
-    } else {
-        // Touch released - determine gesture type
-        if (touch_in_progress) {
-            touch_in_progress = false;
-            
-            int16_t delta_x = touch_last_x - touch_start_x;
-            int16_t delta_y = touch_last_y - touch_start_y;
-            uint32_t duration = millis() - touch_start_time;
-            
-            int16_t abs_delta_x = abs(delta_x);
-            int16_t abs_delta_y = abs(delta_y);
-            
-            // Check if it's a swipe (significant movement)
-            if (duration <= SWIPE_MAX_TIME) {
-                // Horizontal swipe (x movement > y movement)
-                if (abs_delta_x > abs_delta_y && abs_delta_x >= SWIPE_MIN_DISTANCE) {
-                    if (delta_x < 0) {
-                        return GestureType::SWIPE_RIGHT_TO_LEFT;
-                    } else {
-                        return GestureType::SWIPE_LEFT_TO_RIGHT;
-                    }
-                }
-                // Vertical swipe
-                else if (abs_delta_y >= SWIPE_MIN_DISTANCE) {
-                    if (delta_y < 0) {
-                        return GestureType::SWIPE_BOTTOM_TO_TOP;
-                    } else {
-                        return GestureType::SWIPE_TOP_TO_BOTTOM;
-                    }
-                }
-            }
-            
-            // If not a swipe, check if it's a tap (minimal movement)
-            if (abs_delta_x <= TAP_MAX_MOVEMENT && abs_delta_y <= TAP_MAX_MOVEMENT) {
-                return GestureType::TAP;
-            }
-        }
-        
-        return GestureType::NONE;
+// -- Consumer side (loop()) ----------------------------------------------------
+
+void TouchHandler::pumpSamples() {
+    // Samples were lost since the last pump, maybe the lift: whatever the
+    // gesture code thinks is in progress may never end, so start over
+    uint32_t dropped = dropped_samples;
+    if (dropped != seen_dropped) {
+        seen_dropped = dropped;
+        classifier.reset();
+        recognizer.reset();
     }
-}
\ No newline at end of file
+    // Polling: one read per pump. Reading again for every sample taken
+    // would never run dry while a finger is down.
+    if (!task_handle) pollSample();
+    TouchSample s;
+    while (readSample(s)) {
+        GestureType gesture = classifier.feed(s);
+        if (pending_gesture == GestureType::NONE) pending_gesture = gesture;
+        recognizer.feed(s);
+    }
+}
+
+GestureType TouchHandler::detectGesture() {
+    pumpSamples();
+    GestureType gesture = pending_gesture;
+    pending_gesture = GestureType::NONE;
+    return gesture;
+}
+
+void TouchHandler::discardInput() {
+    if (!task_handle) pollSample();
+    TouchSample s;
+    while (samples.pop(s)) last_data = s.data;
+    seen_dropped = dropped_samples;
+    classifier.reset();
+    recognizer.reset();
+    pending_gesture = GestureType::NONE;
+}
+
+bool TouchHandler::readGesture(GestureEvent &e) {
+    pumpSamples();
+    return recognizer.next(e);
+}
@@ -0,0 +1,39 @@
+#include "touch_recorder.h"
+
+bool TouchRecorder::begin(Print &out) {
+    end();
+    out_ = &out;
+    out_->println("# touch trace");
+    return true;
+}
+
+bool TouchRecorder::begin(fs::FS &fs, const char *path) {
+    end();
+    file_ = fs.open(path, "a");
+    if (!file_) {
+        Serial.printf("[touch] can't open %s\n", path);
+        return false;
+    }
+    out_ = &file_;
+    out_->println("# touch trace");
+    Serial.printf("[touch] recording to %s\n", path);
+    return true;
+}
+
+void TouchRecorder::end() {
+    if (file_) file_.close();
+    out_ = nullptr;
+}
+
+void TouchRecorder::record(const TouchSample &s) {
+    if (!out_) return;
+
+    char line[64];
+    int len = snprintf(line, sizeof(line), "@t %lu %u", (unsigned long)s.time_us, s.data.count);
+    for (uint8_t i = 0; i < s.data.count && len < (int)sizeof(line); i++) {
+        len += snprintf(line + len, sizeof(line) - len, " %u %u",
+                        s.data.points[i].x, s.data.points[i].y);
+    }
+    out_->println(line);
+    if (s.data.count == 0 && file_) file_.flush();
+}
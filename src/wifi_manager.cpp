@@ -1,13 +1,16 @@
 #include "wifi_manager.h"
 #include "nvs_manager.h"
+#include "json_util.h"
+#include "json_writer.h"
+#include "boot_profiler.h"
 #include <WiFi.h>
 #include <LittleFS.h>
-#include <HTTPClient.h>
 #include <esp_eap_client.h>
 #include <esp_wifi.h>
 
 // NVS
-static const char* NVS_NS = "wifi";
+static const char* NVS_NS       = "wifi";
+static const char* NVS_FAST_KEY = "fast";
 
 // SoftAP (single source of truth — display uses getPortalSSID())
 static const char AP_SSID[] = "ScoreScrape-Setup";
@@ -15,10 +18,6 @@ static const IPAddress AP_IP(192, 168, 4, 1);
 static const IPAddress AP_GW(192, 168, 4, 1);
 static const IPAddress AP_MASK(255, 255, 255, 0);
 
-// ScoreScrape API ping — returns 200 with "Pong!" body.
-static const char* CAPTIVE_CHECK_URL  = "https://api.scorescrape.io/ping";
-static const char* CAPTIVE_CHECK_RESPONSE = "Pong!";
-
 // IP101GRI PHY on the ESP32-P4-WIFI6-POE-ETH (RMII, fixed pinout)
 #ifndef ETH_PHY_TYPE
 #define ETH_PHY_TYPE  ETH_PHY_IP101
@@ -48,18 +47,9 @@ void WiFiManager::begin(void (*statusCallback)(const char*)) {
     }
 
     loadCredentials();
-    initEthernet();
-
-    // Let ethernet negotiate link + DHCP before we decide what to do.
-    delay(2000);
-
-    if (eth_got_ip_ && checkEthernetInternet()) {
-        Serial.printf("[net]  ethernet: %s\n", ETH.localIP().toString().c_str());
-        state_     = WiFiState::CONNECTED;
-        conn_type_ = ConnType::ETHERNET;
-        hideAP();
-        return;
-    }
+    loadFastConnect();
+    probe_.begin();
+    if (!eth_started_) startEthernet();
 
     // -----------------------------------------------------------------------
     // IMPORTANT: The ESP-Hosted SDIO link to the C6 coprocessor is fragile.
@@ -69,7 +59,10 @@ void WiFiManager::begin(void (*statusCallback)(const char*)) {
     // only WiFi.disconnect() / WiFi.begin() / WiFi.softAP() / softAPdisconnect().
     // -----------------------------------------------------------------------
 
-    if (saved_ssid_.length() > 0) {
+    // Saved WiFi associates while ethernet negotiates; whichever passes the
+    // internet probe first is used.
+    bool tryWifi = saved_ssid_.length() > 0;
+    if (tryWifi) {
         state_ = WiFiState::CONNECTING;
 
         if (statusCallback) {
@@ -78,20 +71,47 @@ void WiFiManager::begin(void (*statusCallback)(const char*)) {
         }
 
         String err = saved_enterprise_
-            ? connectEnterprise(saved_ssid_, saved_user_, saved_pass_)
-            : connectWPA(saved_ssid_, saved_pass_);
-
-        if (err.isEmpty()) {
-            state_     = WiFiState::CONNECTED;
-            conn_type_ = ConnType::WIFI;
-            hideAP();
-            Serial.printf("[net]  wifi: %s %s\n", saved_ssid_.c_str(),
-                          WiFi.localIP().toString().c_str());
-            return;
+            ? startEnterprise(saved_ssid_, saved_user_, saved_pass_)
+            : startWPA(saved_ssid_, saved_pass_);
+        if (!err.isEmpty()) {
+            Serial.printf("[net]  wifi: %s\n", err.c_str());
+            tryWifi = false;
         }
-        Serial.printf("[net]  wifi: %s failed\n", saved_ssid_.c_str());
     }
 
+    ConnType winner = raceConnections(tryWifi, saved_enterprise_ ? 20000 : 15000);
+
+    if (winner == ConnType::ETHERNET) {
+        Serial.printf("[net]  ethernet: %s\n", ETH.localIP().toString().c_str());
+        state_     = WiFiState::CONNECTED;
+        conn_type_ = ConnType::ETHERNET;
+        Network.setDefaultInterface(ETH);
+        if (tryWifi && !KEEP_STANDBY_WIFI) dropWiFi();
+        hideAP();
+        return;
+    }
+
+    if (winner == ConnType::WIFI) {
+        // Ethernet stays up: it costs nothing without a cable, and the
+        // link is there if one goes in later
+        state_     = WiFiState::CONNECTED;
+        conn_type_ = ConnType::WIFI;
+        Network.setDefaultInterface(WiFi.STA);
+        // A fast connect's lease is already the cached one; it's saved
+        // again once DHCP has confirmed it (handleLease())
+        if (fast_active_) lease_ = Lease::CACHED;
+        else              saveFastConnect();
+        probe_.reset(ProbeIface::ETHERNET);
+        hideAP();
+        Serial.printf("[net]  wifi: %s %s\n", saved_ssid_.c_str(),
+                      WiFi.localIP().toString().c_str());
+        return;
+    }
+
+    if (tryWifi) {
+        Serial.printf("[net]  wifi: %s failed\n", saved_ssid_.c_str());
+        dropWiFi();
+    }
     startPortal();
 }
 
@@ -101,6 +121,7 @@ void WiFiManager::handlePortal() {
     if (dns_)    dns_->processNextRequest();
 
     checkPendingConnection();
+    pollScan();
 
     // Deferred portal teardown — gives the phone time to poll /api/status
     // and render the success screen before the SoftAP disappears.
@@ -109,20 +130,43 @@ void WiFiManager::handlePortal() {
         stopPortal();
     }
 
-    // Auto-detect ethernet coming online while portal is up
-    static uint32_t next_eth_poll = 0;
+    // Auto-detect ethernet coming online while portal is up. A plain-HTTP
+    // probe runs in the background every 5 s; only once that passes is the
+    // real ping run, to confirm, before the portal closes.
     uint32_t now = millis();
-    if (eth_got_ip_ && now >= next_eth_poll) {
-        next_eth_poll = now + 5000;
-        if (checkEthernetInternet()) {
-            Serial.println("[net]  ethernet online, closing portal");
-            state_     = WiFiState::CONNECTED;
-            conn_type_ = ConnType::ETHERNET;
-            stopPortal();
+    if (eth_probe_ != EthProbe::IDLE) {
+        uint8_t result = eth_probe_result_;
+        if (result != PROBE_PENDING) {
+            eth_probe_result_ = PROBE_PENDING;
+            bool online = result == PROBE_ONLINE;
+            if (online && eth_probe_ == EthProbe::PLAIN) {
+                eth_probe_ = probe_.checkAsync(ProbeIface::ETHERNET, ProbeKind::HTTPS_PING,
+                                               4000, onEthProbe, this)
+                    ? EthProbe::PING : EthProbe::IDLE;
+            } else {
+                eth_probe_ = EthProbe::IDLE;
+                if (online) {
+                    Serial.println("[net]  ethernet online, closing portal");
+                    state_     = WiFiState::CONNECTED;
+                    conn_type_ = ConnType::ETHERNET;
+                    Network.setDefaultInterface(ETH);
+                    stopPortal();
+                }
+            }
         }
+    } else if (eth_got_ip_ && now >= next_eth_poll_) {
+        next_eth_poll_ = now + 5000;
+        if (probe_.checkAsync(ProbeIface::ETHERNET, ProbeKind::PLAIN_204, 2000,
+                              onEthProbe, this))
+            eth_probe_ = EthProbe::PLAIN;
     }
 }
 
+void WiFiManager::onEthProbe(ProbeIface, const ProbeResult& result, void* ctx) {
+    static_cast<WiFiManager*>(ctx)->eth_probe_result_ =
+        result.online ? PROBE_ONLINE : PROBE_OFFLINE;
+}
+
 const char* WiFiManager::getPortalSSID() const {
     return AP_SSID;
 }
@@ -140,6 +184,13 @@ String WiFiManager::getIP() const {
 
 // -- Ethernet ---------------------------------------------------------------
 
+void WiFiManager::startEthernet() {
+    eth_started_ = true;
+    eth_started_ms_ = millis();
+    BootProfiler::instance().begin(BootPhase::ETH_DHCP);
+    initEthernet();
+}
+
 void WiFiManager::initEthernet() {
     Network.onEvent(ethEventHandler);
     ETH.begin(ETH_PHY_TYPE, ETH_PHY_ADDR, ETH_PHY_MDC, ETH_PHY_MDIO,
@@ -157,6 +208,7 @@ void WiFiManager::ethEventHandler(arduino_event_id_t event) {
         break;
     case ARDUINO_EVENT_ETH_GOT_IP:
         eth_got_ip_ = true;
+        BootProfiler::instance().end(BootPhase::ETH_DHCP);
         Serial.printf("[net]  eth: %s\n", ETH.localIP().toString().c_str());
         break;
     case ARDUINO_EVENT_ETH_LOST_IP:
@@ -178,20 +230,8 @@ void WiFiManager::ethEventHandler(arduino_event_id_t event) {
 
 bool WiFiManager::checkEthernetInternet() {
     if (!eth_got_ip_) return false;
-    HTTPClient http;
-    http.begin(CAPTIVE_CHECK_URL);
-    http.setTimeout(4000);
-    int code = http.GET();
-
-    if (code == 200) {
-        String response = http.getString();
-        http.end();
-        response.trim();
-        return response == CAPTIVE_CHECK_RESPONSE;
-    }
-
-    http.end();
-    return false;
+    BootPhaseScope timed(BootPhase::INTERNET_PROBE);
+    return probe_.check(ProbeIface::ETHERNET, ProbeKind::HTTPS_PING, 4000).online;
 }
 
 
@@ -219,50 +259,98 @@ void WiFiManager::saveCredentials(const String& ssid, const String& pass,
 }
 
 
+void WiFiManager::loadFastConnect() {
+    fast_valid_ = false;
+    size_t len = NvsManager::instance().getBlob(NVS_NS, NVS_FAST_KEY, &fast_, sizeof(fast_));
+    if (len != sizeof(fast_) || fast_.version != FAST_VERSION) return;
+    fast_.ssid[sizeof(fast_.ssid) - 1] = '\0';
+    fast_valid_ = saved_ssid_.length() > 0 && saved_ssid_ == fast_.ssid;
+}
+
+// After a connect that passed the probe, with the lease DHCP gave us
+void WiFiManager::saveFastConnect() {
+    const uint8_t* bssid = WiFi.BSSID();
+    if (!bssid || WiFi.localIP() == INADDR_NONE) return;
+    memset(&fast_, 0, sizeof(fast_));
+    fast_.version = FAST_VERSION;
+    fast_.channel = (uint8_t)WiFi.channel();
+    memcpy(fast_.bssid, bssid, sizeof(fast_.bssid));
+    strncpy(fast_.ssid, WiFi.SSID().c_str(), sizeof(fast_.ssid) - 1);
+    fast_.ip      = (uint32_t)WiFi.localIP();
+    fast_.gateway = (uint32_t)WiFi.gatewayIP();
+    fast_.mask    = (uint32_t)WiFi.subnetMask();
+    fast_.dns1    = (uint32_t)WiFi.dnsIP(0);
+    fast_.dns2    = (uint32_t)WiFi.dnsIP(1);
+    fast_valid_ = true;
+    if (!NvsManager::instance().putBlob(NVS_NS, NVS_FAST_KEY, &fast_, sizeof(fast_))) {
+        Serial.println("[net]  fast connect save failed");
+    }
+}
+
+void WiFiManager::clearFastConnect() {
+    if (!fast_valid_) return;
+    fast_valid_ = false;
+    NvsManager::instance().remove(NVS_NS, NVS_FAST_KEY);
+}
+
+void WiFiManager::applyFastConfig() {
+    WiFi.config(IPAddress(fast_.ip), IPAddress(fast_.gateway), IPAddress(fast_.mask),
+                IPAddress(fast_.dns1), IPAddress(fast_.dns2));
+    static_ip_ = true;
+}
+
+// The cached lease only had to get us through boot; the router has no
+// record of it. Starting DHCP drops the address until the server answers.
+// The client asks for the same one again when lwIP is built with
+// CONFIG_LWIP_DHCP_RESTORE_LAST_IP, and servers re-offer a client its last
+// address anyway, so normally nothing changes. If it does, the new lease
+// is the one cached.
+void WiFiManager::handleLease() {
+    if (lease_ == Lease::CACHED) {
+        WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+        static_ip_      = false;
+        fast_active_    = false;
+        lease_          = Lease::RENEWING;
+        lease_start_ms_ = millis();
+        return;
+    }
+    if (lease_ != Lease::RENEWING) return;
+
+    IPAddress ip = WiFi.localIP();
+    if (ip == INADDR_NONE) {
+        if (millis() - lease_start_ms_ < LEASE_RENEW_MS) return;
+        Serial.println("[net]  wifi: no DHCP answer, keeping the cached lease");
+        applyFastConfig();
+        lease_ = Lease::DHCP;
+        return;
+    }
+    if (ip != IPAddress(fast_.ip)) {
+        Serial.printf("[net]  wifi: DHCP moved us from %s to %s\n",
+                      IPAddress(fast_.ip).toString().c_str(), ip.toString().c_str());
+    }
+    lease_ = Lease::DHCP;
+    saveFastConnect();
+}
+
+
 // -- WiFi connection --------------------------------------------------------
 // CRITICAL: Never call WiFi.mode() in these functions. The ESP-Hosted SDIO
 // link to the C6 coprocessor does not survive mode transitions. We stay in
 // WIFI_AP_STA permanently and only use disconnect/begin/softAP.
 
-static bool waitForAssociation(uint32_t timeout_ms) {
-    uint32_t deadline = millis() + timeout_ms;
-    while (WiFi.status() != WL_CONNECTED && millis() < deadline)
-        delay(250);
-    return WiFi.status() == WL_CONNECTED;
-}
-
-String WiFiManager::connectWPA(const String& ssid, const String& pass,
-                               uint32_t timeout_ms) {
+String WiFiManager::startWPA(const String& ssid, const String& pass) {
     // No WiFi.mode() call — we're already in AP_STA.
     // Use disconnect(false) to avoid eraseAP RPC which can disrupt the hosted link.
     WiFi.disconnect(false);
     delay(100);
 
-    if (pass.length() > 0)
-        WiFi.begin(ssid.c_str(), pass.c_str());
-    else
-        WiFi.begin(ssid.c_str());
-
-    if (!waitForAssociation(timeout_ms)) {
-        Serial.printf("[net]  wifi: %s timeout (status=%d)\n", ssid.c_str(), WiFi.status());
-        WiFi.disconnect(false);
-        if (pass.length() > 0)
-            return "Could not connect. Check that the password is correct.";
-        return "Could not connect to the open network.";
-    }
-
-    if (!checkInternet()) {
-        Serial.printf("[net]  wifi: %s no internet\n", ssid.c_str());
-        WiFi.disconnect(false);
-        return "Connected to WiFi, but the network has no internet access. "
-               "It may require a captive portal login that this device cannot complete.";
-    }
-
+    BootProfiler::instance().begin(BootPhase::WIFI_ASSOC);
+    beginStation(ssid, pass.c_str(), true);
     return "";
 }
 
-String WiFiManager::connectEnterprise(const String& ssid, const String& user,
-                                      const String& pass, uint32_t timeout_ms) {
+String WiFiManager::startEnterprise(const String& ssid, const String& user,
+                                    const String& pass) {
     // No WiFi.mode() call — we're already in AP_STA.
     WiFi.disconnect(false);
     delay(100);
@@ -286,47 +374,108 @@ String WiFiManager::connectEnterprise(const String& ssid, const String& user,
                "coprocessor firmware. A firmware update may be required.";
     }
 
-    WiFi.begin(ssid.c_str());
+    BootProfiler::instance().begin(BootPhase::WIFI_ASSOC);
+    beginStation(ssid, nullptr, true);
+    return "";
+}
+
+void WiFiManager::beginStation(const String& ssid, const char* pass, bool fast) {
+    if (pass && !pass[0]) pass = nullptr;
+    fast_active_ = fast && fast_valid_ && ssid == fast_.ssid;
 
-    if (!waitForAssociation(timeout_ms)) {
-        Serial.printf("[net]  wifi: %s timeout (status=%d)\n", ssid.c_str(), WiFi.status());
-        esp_wifi_sta_enterprise_disable();
-        WiFi.disconnect(false);
-        return "Enterprise authentication failed. Check your username and password.";
+    if (fast_active_) {
+        applyFastConfig();
+        Serial.printf("[net]  wifi: %s fast connect (ch %u)\n", ssid.c_str(), fast_.channel);
+        WiFi.begin(ssid.c_str(), pass, fast_.channel, fast_.bssid);
+        return;
     }
 
-    if (!checkInternet()) {
-        Serial.printf("[net]  wifi: %s no internet\n", ssid.c_str());
-        esp_wifi_sta_enterprise_disable();
-        WiFi.disconnect(false);
-        return "Connected to WiFi, but the network has no internet access.";
+    if (static_ip_) {
+        // Back to DHCP
+        WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+        static_ip_ = false;
     }
+    WiFi.begin(ssid.c_str(), pass);
+}
 
-    return "";
+void WiFiManager::dropWiFi() {
+    if (saved_enterprise_) esp_wifi_sta_enterprise_disable();
+    WiFi.disconnect(false);
+    probe_.reset(ProbeIface::WIFI);
+    if (static_ip_) {
+        WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+        static_ip_ = false;
+    }
 }
 
-bool WiFiManager::checkInternet() {
-    HTTPClient http;
-    http.begin(CAPTIVE_CHECK_URL);
-    http.setTimeout(5000);
-    int code = http.GET();
-
-    if (code == 200) {
-        String response = http.getString();
-        http.end();
-        response.trim();
-
-        if (response == CAPTIVE_CHECK_RESPONSE) {
-            return true;
-        } else {
-            Serial.printf("[net]  ping: unexpected response '%s'\n", response.c_str());
-            return false;
+// Each interface is probed as soon as it has an address. Probes share the
+// default route, so they take turns (each pins the route to its own
+// interface); what overlaps is the slow part, association and DHCP.
+ConnType WiFiManager::raceConnections(bool wifi, uint32_t wifi_timeout_ms) {
+    uint32_t wifi_start = millis();
+    bool     eth_probed = false;
+    bool     wifi_done  = !wifi;
+
+    for (;;) {
+        if (!eth_probed && eth_got_ip_) {
+            eth_probed = true;
+            if (checkEthernetInternet()) return ConnType::ETHERNET;
+            Serial.println("[net]  ethernet: no internet");
         }
+
+        if (!wifi_done) {
+            const char* pass = saved_enterprise_ ? nullptr : saved_pass_.c_str();
+            if (WiFi.status() == WL_CONNECTED) {
+                BootProfiler::instance().end(BootPhase::WIFI_ASSOC);
+                if (checkInternet()) return ConnType::WIFI;
+                if (fast_active_) {
+                    // The old lease may have been handed to someone else
+                    Serial.printf("[net]  wifi: %s no internet on cached lease, retrying\n",
+                                  saved_ssid_.c_str());
+                    clearFastConnect();
+                    WiFi.disconnect(false);
+                    delay(100);
+                    BootProfiler::instance().begin(BootPhase::WIFI_ASSOC);
+                    beginStation(saved_ssid_, pass, false);
+                    wifi_start = millis();
+                } else {
+                    wifi_done = true;
+                    Serial.printf("[net]  wifi: %s no internet\n", saved_ssid_.c_str());
+                }
+            } else if (fast_active_ && millis() - wifi_start >= FAST_ASSOC_MS) {
+                // AP gone, moved channel or replaced: scan for it
+                Serial.printf("[net]  wifi: %s cached AP not found, scanning\n",
+                              saved_ssid_.c_str());
+                clearFastConnect();
+                WiFi.disconnect(false);
+                delay(100);
+                beginStation(saved_ssid_, pass, false);
+                wifi_start = millis();
+            } else if (millis() - wifi_start >= wifi_timeout_ms) {
+                wifi_done = true;
+                BootProfiler::instance().end(BootPhase::WIFI_ASSOC);
+                Serial.printf("[net]  wifi: %s timeout (status=%d)\n",
+                              saved_ssid_.c_str(), WiFi.status());
+            }
+        }
+
+        // Ethernet only holds things up while it could still win: once
+        // WiFi is out of the running, give it ETH_SETTLE_MS from start, or
+        // ETH_DHCP_MS if a cable is in and DHCP is under way
+        if (wifi_done) {
+            uint32_t eth_wait = eth_link_up_ ? ETH_DHCP_MS : ETH_SETTLE_MS;
+            if (eth_probed || millis() - eth_started_ms_ >= eth_wait) {
+                BootProfiler::instance().end(BootPhase::ETH_DHCP);
+                return ConnType::NONE;
+            }
+        }
+        delay(RACE_POLL_MS);
     }
+}
 
-    http.end();
-    Serial.printf("[net]  ping: http %d\n", code);
-    return false;
+bool WiFiManager::checkInternet() {
+    BootPhaseScope timed(BootPhase::INTERNET_PROBE);
+    return probe_.check(ProbeIface::WIFI, ProbeKind::HTTPS_PING, 5000).online;
 }
 
 
@@ -350,6 +499,7 @@ void WiFiManager::startPortal() {
     server_->on("/api/scan",    HTTP_GET,  [this]() { serveScan(); });
     server_->on("/api/connect", HTTP_POST, [this]() { serveConnect(); });
     server_->on("/api/status",  HTTP_GET,  [this]() { serveStatus(); });
+    server_->on("/api/boot",    HTTP_GET,  [this]() { serveBoot(); });
     server_->onNotFound(                   [this]() { serveRedirect(); });
     server_->begin();
 
@@ -395,7 +545,9 @@ void WiFiManager::checkPendingConnection() {
         if (checkInternet()) {
             saveCredentials(pending_ssid_, pending_pass_,
                             pending_user_, pending_enterprise_);
+            saveFastConnect();
             conn_type_       = ConnType::WIFI;
+            Network.setDefaultInterface(WiFi.STA);
             pending_connect_ = false;
             pending_result_  = "connected";
             pending_ip_      = WiFi.localIP().toString();
@@ -438,28 +590,86 @@ void WiFiManager::serveFile(const char* path, const char* mime) {
     f.close();
 }
 
+// Portal API responses are streamed with chunked transfer encoding through
+// JsonWriter's buffer, so none of them is built up on the heap first
+static void sendChunk(const char* data, size_t len, void* ctx) {
+    static_cast<WebServer*>(ctx)->sendContent(data, len);
+}
+
+void WiFiManager::beginJsonResponse() {
+    server_->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server_->send(200, "application/json", "");
+}
+
+void WiFiManager::endJsonResponse(JsonWriter& w) {
+    w.flush();
+    server_->sendContent("");   // last chunk
+}
+
+// The scan itself runs in the background (pollScan() from handlePortal()),
+// so this only ever returns what's cached, starting a refresh if it's old
 void WiFiManager::serveScan() {
-    int n = WiFi.scanNetworks();
-    String json;
-    json.reserve(n * 80);
-    json = "[";
+    uint32_t stale = server_->hasArg("refresh") ? SCAN_REFRESH_MS : SCAN_STALE_MS;
+    if (!scanning_ && (scan_ms_ == 0 || millis() - scan_ms_ >= stale)) startScan();
+
+    beginJsonResponse();
+    JsonWriter w(sendChunk, server_);
+    w.beginObject().key("age_ms");
+    if (scan_ms_) w.value(millis() - scan_ms_);
+    else          w.null();
+    w.field("scanning", scanning_).key("networks").beginArray();
+    for (uint8_t i = 0; i < scan_count_; i++) {
+        const ScanEntry& e = scan_[i];
+        w.beginObject()
+         .field("ssid", e.ssid)
+         .field("rssi", e.rssi)
+         .field("ch", e.channel)
+         .field("open", e.open)
+         .field("enterprise", e.enterprise)
+         .endObject();
+    }
+    w.endArray().endObject();
+    endJsonResponse(w);
+}
 
-    for (int i = 0; i < n; i++) {
-        if (i) json += ',';
+void WiFiManager::startScan() {
+    // Scanning hops channels, which would get in the way of an association
+    if (pending_connect_) return;
+    next_scan_at_ = millis() + SCAN_INTERVAL_MS;
+    int16_t r = WiFi.scanNetworks(true);
+    scanning_ = r == WIFI_SCAN_RUNNING;
+    if (!scanning_) Serial.printf("[net]  scan: start failed (%d)\n", r);
+}
+
+void WiFiManager::pollScan() {
+    if (!scanning_) {
+        if ((int32_t)(millis() - next_scan_at_) >= 0) startScan();
+        return;
+    }
+
+    int16_t n = WiFi.scanComplete();
+    if (n == WIFI_SCAN_RUNNING) return;
+    scanning_ = false;
+    if (n < 0) {
+        // Failed: keep the old results, try again next interval
+        Serial.printf("[net]  scan: failed (%d)\n", n);
+        return;
+    }
+
+    scan_count_ = (uint8_t)min<int>(n, SCAN_MAX);   // strongest first
+    for (uint8_t i = 0; i < scan_count_; i++) {
+        ScanEntry& e = scan_[i];
         wifi_auth_mode_t auth = WiFi.encryptionType(i);
-        bool open = (auth == WIFI_AUTH_OPEN);
-        bool ent  = (auth == WIFI_AUTH_WPA2_ENTERPRISE ||
-                     auth == WIFI_AUTH_WPA3_ENTERPRISE);
-
-        json += "{\"ssid\":\"" + WiFi.SSID(i) + "\""
-                ",\"rssi\":" + String(WiFi.RSSI(i)) +
-                ",\"ch\":"   + String(WiFi.channel(i)) +
-                ",\"open\":" + (open ? "true" : "false") +
-                ",\"enterprise\":" + (ent ? "true" : "false") + "}";
+        e.open       = (auth == WIFI_AUTH_OPEN);
+        e.enterprise = (auth == WIFI_AUTH_WPA2_ENTERPRISE ||
+                        auth == WIFI_AUTH_WPA3_ENTERPRISE);
+        e.rssi       = (int8_t)WiFi.RSSI(i);
+        e.channel    = (uint8_t)WiFi.channel(i);
+        strncpy(e.ssid, WiFi.SSID(i).c_str(), sizeof(e.ssid) - 1);
+        e.ssid[sizeof(e.ssid) - 1] = '\0';
     }
-    json += "]";
     WiFi.scanDelete();
-    server_->send(200, "application/json", json);
+    scan_ms_ = millis();
 }
 
 void WiFiManager::serveConnect() {
@@ -468,11 +678,16 @@ void WiFiManager::serveConnect() {
         return;
     }
 
-    String body = server_->arg("plain");
-    String ssid = extractJsonValue(body, "ssid");
-    String pass = extractJsonValue(body, "pass");
-    String user = extractJsonValue(body, "user");
-    bool   ent  = extractJsonValue(body, "enterprise") == "true";
+    String  body = server_->arg("plain");
+    JsonDoc doc;
+    if (!doc.parse(body)) {
+        server_->send(400, "application/json", "{\"ok\":false,\"msg\":\"Bad request\"}");
+        return;
+    }
+    String ssid = doc.get("ssid").toString();
+    String pass = doc.get("pass").toString();
+    String user = doc.get("user").toString();
+    bool   ent  = doc.get("enterprise").equals("true");   // "true" or true
 
     if (ssid.isEmpty()) {
         server_->send(400, "application/json", "{\"ok\":false,\"msg\":\"Missing SSID\"}");
@@ -501,16 +716,18 @@ void WiFiManager::serveConnect() {
         }
     }
 
+    if (scanning_) {
+        esp_wifi_scan_stop();
+        WiFi.scanDelete();
+        scanning_ = false;
+    }
     WiFi.disconnect(false);
     delay(100);
 
     Serial.printf("[net]  wifi: connecting %s%s\n", ssid.c_str(),
                   ent ? " (enterprise)" : "");
 
-    if (ent || pass.isEmpty())
-        WiFi.begin(ssid.c_str());
-    else
-        WiFi.begin(ssid.c_str(), pass.c_str());
+    beginStation(ssid, ent ? nullptr : pass.c_str(), false);
 
     // Store pending state — checkPendingConnection() monitors from the main loop.
     pending_connect_    = true;
@@ -527,60 +744,34 @@ void WiFiManager::serveConnect() {
 }
 
 void WiFiManager::serveStatus() {
+    beginJsonResponse();
+    JsonWriter w(sendChunk, server_);
+    w.beginObject();
+
     if (pending_result_ == "connected") {
-        server_->send(200, "application/json",
-                      "{\"status\":\"connected\",\"ip\":\"" + pending_ip_ + "\"}");
+        w.field("status", "connected").field("ip", pending_ip_);
         state_ = WiFiState::CONNECTED;
         if (portal_stop_at_ == 0)
             portal_stop_at_ = millis() + 5000;
-        return;
-    }
-
-    if (pending_result_ == "failed") {
-        String err = pending_error_;
-        err.replace("\"", "\\\"");
+    } else if (pending_result_ == "failed") {
+        w.field("status", "failed").field("msg", pending_error_);
         pending_result_ = "";
-        server_->send(200, "application/json",
-                      "{\"status\":\"failed\",\"msg\":\"" + err + "\"}");
-        return;
+    } else {
+        w.field("status", pending_connect_ ? "connecting" : "idle");
     }
 
-    if (pending_connect_) {
-        server_->send(200, "application/json", "{\"status\":\"connecting\"}");
-        return;
-    }
+    w.endObject();
+    endJsonResponse(w);
+}
 
-    server_->send(200, "application/json", "{\"status\":\"idle\"}");
+void WiFiManager::serveBoot() {
+    beginJsonResponse();
+    JsonWriter w(sendChunk, server_);
+    BootProfiler::instance().toJson(w, true);
+    endJsonResponse(w);
 }
 
 void WiFiManager::serveRedirect() {
     server_->sendHeader("Location", "http://192.168.4.1/", true);
     server_->send(302, "text/plain", "");
 }
-
-
-// -- JSON helper ------------------------------------------------------------
-
-String WiFiManager::extractJsonValue(const String& json, const char* key) {
-    String needle = String("\"") + key + "\"";
-    int ki = json.indexOf(needle);
-    if (ki < 0) return "";
-
-    int ci = json.indexOf(':', ki + needle.length());
-    if (ci < 0) return "";
-
-    int vi = ci + 1;
-    while (vi < (int)json.length() && json[vi] == ' ') vi++;
-    if (vi >= (int)json.length()) return "";
-
-    if (json[vi] == '"') {
-        int end = json.indexOf('"', vi + 1);
-        return (end > vi) ? json.substring(vi + 1, end) : "";
-    }
-
-    // Bare value (bool, number)
-    int end = vi;
-    while (end < (int)json.length() && json[end] != ',' && json[end] != '}')
-        end++;
-    return json.substring(vi, end);
-}